@@ -0,0 +1,67 @@
+#include "txeo/Tensor.h"
+#include "txeo/detail/Gemm.h"
+#include "txeo/detail/TensorHelper.h"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <tensorflow/cc/ops/math_ops.h>
+#include <tensorflow/core/framework/tensor.h>
+#include <vector>
+
+namespace {
+
+// Average time, in microseconds, of one call
+double time_per_call(size_t calls, const std::function<void()> &func) {
+  func(); // Warm-up
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i{0}; i < calls; ++i)
+    func();
+  std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+  return elapsed.count() / calls;
+}
+
+tf::Tensor make_tf_matrix(size_t size) {
+  tf::Tensor resp{tf::DT_FLOAT,
+                  tf::TensorShape{static_cast<int64_t>(size), static_cast<int64_t>(size)}};
+  auto flat = resp.flat<float>();
+  for (int64_t i{0}; i < flat.size(); ++i)
+    flat(i) = static_cast<float>(i % 13) * 0.1f;
+
+  return resp;
+}
+
+} // namespace
+
+int main() {
+  // ============================================================================================
+  // Native GEMM against TensorFlow MatMul for square float matrices of growing size
+  // ============================================================================================
+  std::cout << "Native volume limit (m * n * k): " << txeo::detail::native_gemm_max_volume
+            << "\n";
+
+  for (size_t size : {8, 16, 32, 64, 96, 128, 160, 192, 256, 384, 512}) {
+    auto left = make_tf_matrix(size);
+    auto right = make_tf_matrix(size);
+    std::vector<float> out(size * size);
+    size_t calls = size <= 128 ? 200 : 20;
+
+    auto native = time_per_call(calls, [&]() {
+      txeo::detail::gemm(false, false, size, size, size, left.flat<float>().data(),
+                         right.flat<float>().data(), out.data());
+    });
+    auto tensorflow = time_per_call(calls, [&]() {
+      auto aux = txeo::detail::TensorHelper::ope_tensors<float>(
+          left, right, "MatMul", [](const tf::Scope &scope, tf::Input left, tf::Input right) {
+            return tf::ops::MatMul(scope, left, right);
+          });
+    });
+
+    std::cout << size << "x" << size << ": native " << native << " us, TensorFlow " << tensorflow
+              << " us, volume " << size * size * size << " -> "
+              << (native < tensorflow ? "native" : "TensorFlow") << "\n";
+  }
+
+  return 0;
+}
@@ -0,0 +1,58 @@
+#include "txeo/Matrix.h"
+#include "txeo/Tensor.h"
+#include "txeo/TensorAgg.h"
+#include "txeo/TensorFunc.h"
+#include "txeo/TensorOp.h"
+#include "txeo/detail/TensorHelper.h"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+
+namespace {
+
+// Average time, in microseconds, of one call
+double time_per_call(size_t calls, const std::function<void()> &func) {
+  func(); // Warm-up
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i{0}; i < calls; ++i)
+    func();
+  std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+  return elapsed.count() / calls;
+}
+
+void compare(const std::string &name, size_t calls, const std::function<void()> &func) {
+  txeo::detail::TensorHelper::enable_graph_cache(false);
+  auto uncached = time_per_call(calls, func);
+  txeo::detail::TensorHelper::enable_graph_cache(true);
+  auto cached = time_per_call(calls, func);
+
+  std::cout << name << ": " << uncached << " us/call (rebuilding graph) vs " << cached
+            << " us/call (cached graph), speedup " << uncached / cached << "x\n";
+}
+
+} // namespace
+
+int main() {
+  // ============================================================================================
+  // Per-call overhead of TensorFlow backed operations, with and without graph reuse
+  // ============================================================================================
+  constexpr size_t calls{2000};
+
+  txeo::Tensor<float> tensor({32, 16}, 1.0f);
+  txeo::Matrix<float> left(32, 16, 1.0f);
+  txeo::Matrix<float> right(16, 8, 2.0f);
+
+  compare("TensorAgg::reduce_sum", calls,
+          [&]() { auto aux = txeo::TensorAgg<float>::reduce_sum(tensor, {1}); });
+
+  compare("TensorOp::product_tensors", calls,
+          [&]() { auto aux = txeo::TensorOp<float>::product_tensors(left, right); });
+
+  compare("TensorFunc::permute", calls,
+          [&]() { auto aux = txeo::TensorFunc<float>::permute(tensor, {1, 0}); });
+
+  return 0;
+}
@@ -0,0 +1,56 @@
+#include "txeo/Predictor.h"
+#include "txeo/Tensor.h"
+#include "txeo/TensorShape.h"
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Average time, in microseconds, of one prediction
+double time_per_call(const txeo::Predictor<float> &predictor, const txeo::Tensor<float> &input,
+                     size_t calls) {
+  auto aux = predictor.predict(input); // Warm-up
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i{0}; i < calls; ++i)
+    aux = predictor.predict(input);
+  std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+  return elapsed.count() / calls;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  // ============================================================================================
+  // Per-call latency of small predictions, with named feeds and with pre-bound callables
+  // ============================================================================================
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <saved_model_dir> [calls]\n";
+    return 1;
+  }
+  size_t calls = argc > 2 ? std::stoul(argv[2]) : 5000;
+
+  txeo::Predictor<float> predictor{argv[1]};
+
+  // A single row of the first input, with unknown dimensions taken as one
+  auto dims = predictor.get_input_metadata()[0].second.axes_dims();
+  std::vector<size_t> shape;
+  for (auto dim : dims)
+    shape.emplace_back(dim > 0 ? static_cast<size_t>(dim) : 1);
+  txeo::Tensor<float> input{txeo::TensorShape(shape), 0.5f};
+
+  predictor.enable_callables(false);
+  auto named = time_per_call(predictor, input, calls);
+  predictor.enable_callables(true);
+  auto bound = time_per_call(predictor, input, calls);
+
+  std::cout << "Predictor::predict, input " << input.shape() << ": " << named
+            << " us/call (named feeds) vs " << bound << " us/call (callable), speedup "
+            << named / bound << "x\n";
+
+  return 0;
+}
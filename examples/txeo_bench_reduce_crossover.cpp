@@ -0,0 +1,71 @@
+#include "txeo/detail/Reduction.h"
+#include "txeo/detail/TensorHelper.h"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <tensorflow/cc/ops/math_ops.h>
+#include <tensorflow/core/framework/tensor.h>
+#include <vector>
+
+namespace {
+
+// Average time, in microseconds, of one call
+double time_per_call(size_t calls, const std::function<void()> &func) {
+  func(); // Warm-up
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i{0}; i < calls; ++i)
+    func();
+  std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+  return elapsed.count() / calls;
+}
+
+tf::Tensor make_tf_matrix(size_t rows, size_t cols) {
+  tf::Tensor resp{tf::DT_FLOAT,
+                  tf::TensorShape{static_cast<int64_t>(rows), static_cast<int64_t>(cols)}};
+  auto flat = resp.flat<float>();
+  for (int64_t i{0}; i < flat.size(); ++i)
+    flat(i) = static_cast<float>(i % 13) * 0.1f;
+
+  return resp;
+}
+
+} // namespace
+
+int main() {
+  // ============================================================================================
+  // Native reduction against TensorFlow ReduceSum for float matrices of growing size, reducing
+  // the rows (contiguous inner loop) and the columns (elementwise accumulation of rows)
+  // ============================================================================================
+  std::cout << "Native size limit: " << txeo::detail::native_reduce_max_size << "\n";
+
+  for (size_t rows : {4, 64, 256, 1024, 4096, 16384}) {
+    size_t cols{256};
+    auto matrix = make_tf_matrix(rows, cols);
+    size_t calls = rows <= 1024 ? 200 : 20;
+
+    for (size_t axis : {0, 1}) {
+      std::vector<bool> reduced{axis == 0, axis == 1};
+      std::vector<float> out(axis == 0 ? cols : rows);
+
+      auto native = time_per_call(calls, [&]() {
+        txeo::detail::reduce(txeo::detail::ReduceOp::SUM, matrix.flat<float>().data(),
+                             {rows, cols}, reduced, out.data());
+      });
+      auto tensorflow = time_per_call(calls, [&]() {
+        auto aux = txeo::detail::TensorHelper::reduce_tensor<float>(
+            matrix, {axis}, "ReduceSum",
+            [](const tf::Scope &scope, tf::Input input, tf::Input axis) -> tf::Output {
+              return tf::ops::ReduceSum(scope, input, axis);
+            });
+      });
+
+      std::cout << rows << "x" << cols << " axis " << axis << ": native " << native
+                << " us, TensorFlow " << tensorflow << " us, size " << rows * cols << " -> "
+                << (native < tensorflow ? "native" : "TensorFlow") << "\n";
+    }
+  }
+
+  return 0;
+}
@@ -5,6 +5,7 @@
 #include "txeo/Matrix.h"
 
 #include <cstddef>
+#include <filesystem>
 #include <stdexcept>
 #include <vector>
 
@@ -279,6 +280,31 @@ class DataTable {
     DataTable(const txeo::Matrix<T> &x_train, const txeo::Matrix<T> &y_train)
         : DataTable{std::move(x_train.clone()), std::move(y_train.clone())} {};
 
+    /**
+     * @brief Creates a DataTable from a columnar file, reading only the feature/label columns
+     *
+     * Only the blocks of @p x_cols and @p y_cols are read from disk, so the cost does not depend on
+     * the number of other columns in the file (see @ref txeo::MatrixIO::write_columnar_file).
+     *
+     * @param path Path to a columnar file
+     * @param x_cols Column indices for feature columns
+     * @param y_cols Column indices for label columns
+     * @param eval_percent Percentage of data reserved for evaluation [0,100[ (zero means none)
+     * @param test_percent Percentage of data reserved for test [0,100[ (zero means none)
+     *
+     * @throws DataTableError
+     * @throws MatrixIOError
+     *
+     * **Example Usage:**
+     * @code
+     * // 5 out of the 200 columns of the file
+     * auto dt = DataTable<double>::from_columnar_file("train.txcol", {0, 1, 2, 3}, {199}, 20);
+     * @endcode
+     */
+    static DataTable<T> from_columnar_file(const std::filesystem::path &path,
+                                           std::vector<size_t> x_cols, std::vector<size_t> y_cols,
+                                           size_t eval_percent = 0, size_t test_percent = 0);
+
     /**
      * @brief Returns training inputs matrix.
      *
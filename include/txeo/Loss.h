@@ -3,6 +3,7 @@
 #pragma once
 
 #include "txeo/Tensor.h"
+#include "txeo/TensorView.h"
 #include "txeo/types.h"
 
 #include <functional>
@@ -67,7 +68,7 @@ class Loss {
     /**
      * @brief Compute loss using currently selected function
      *
-     * @param pred Prediction tensor
+     * @param pred Prediction tensor (or a view of one)
      * @return T Calculated loss value
      * @throw LossError If shapes mismatch or invalid input values
      *
@@ -77,7 +78,7 @@ class Loss {
      * std::cout << "Current loss: " << error << std::endl;
      * @endcode
      */
-    T get_loss(const txeo::Tensor<T> &pred) const;
+    T get_loss(const txeo::TensorView<T> &pred) const;
 
     /**
      * @brief Set the active loss function
@@ -97,59 +98,59 @@ class Loss {
      *
      * @f[ MSE = \frac{1}{N}\sum_{i=1}^{N}(y_i - \hat{y}_i)^2 @f]
      *
-     * @param pred Prediction tensor
+     * @param pred Prediction tensor (or a view of one)
      * @return T MSE value
      */
-    T mean_squared_error(const txeo::Tensor<T> &pred) const;
+    T mean_squared_error(const txeo::TensorView<T> &pred) const;
 
     /**
      * @brief Compute Mean Absolute Error (MAE)
      *
      * @f[ MAE = \frac{1}{N}\sum_{i=1}^{N}|y_i - \hat{y}_i| @f]
      *
-     * @param pred Prediction tensor
+     * @param pred Prediction tensor (or a view of one)
      * @return T MAE value
      */
-    T mean_absolute_error(const txeo::Tensor<T> &pred) const;
+    T mean_absolute_error(const txeo::TensorView<T> &pred) const;
 
     /**
      * @brief Compute Mean Squared Logarithmic Error (MSLE)
      *
      * @f[ MSLE = \frac{1}{N}\sum_{i=1}^{N}(\log(1+y_i) - \log(1+\hat{y}_i))^2 @f]
      *
-     * @param pred Prediction tensor
+     * @param pred Prediction tensor (or a view of one)
      * @return T MSLE value
      * @throw LossError If any values are negative
      */
-    T mean_squared_logarithmic_error(const txeo::Tensor<T> &pred) const;
+    T mean_squared_logarithmic_error(const txeo::TensorView<T> &pred) const;
 
     /**
      * @brief Compute Log-Cosh Error (LCHE)
      *
      * @f[ LCHE = \frac{1}{N}\sum_{i=1}^{N}\log(\cosh(y_i - \hat{y}_i)) @f]
      *
-     * @param pred Prediction tensor
+     * @param pred Prediction tensor (or a view of one)
      * @return T LCHE value
      */
-    T log_cosh_error(const txeo::Tensor<T> &pred) const;
+    T log_cosh_error(const txeo::TensorView<T> &pred) const;
 
     const txeo::Tensor<T> &label() const { return _label; }
 
     /// @name Shorthand Aliases
     /// @{
-    T mse(const txeo::Tensor<T> &pred) const {
+    T mse(const txeo::TensorView<T> &pred) const {
       return mean_squared_error(pred);
     }; ///< @see mean_squared_error
 
-    T mae(const txeo::Tensor<T> &pred) const {
+    T mae(const txeo::TensorView<T> &pred) const {
       return mean_absolute_error(pred);
     }; ///< @see mean_absolute_error
 
-    T msle(const txeo::Tensor<T> &pred) const {
+    T msle(const txeo::TensorView<T> &pred) const {
       return mean_squared_logarithmic_error(pred);
     }; ///< @see mean_squared_logarithmic_error
 
-    T lche(const txeo::Tensor<T> &pred) const {
+    T lche(const txeo::TensorView<T> &pred) const {
       return log_cosh_error(pred);
     }; ///< @see log_cosh_error
     /// @}
@@ -158,8 +159,8 @@ class Loss {
     Loss() = default;
     txeo::Tensor<T> _label{};
 
-    void verify_parameter(const txeo::Tensor<T> &pred) const;
-    std::function<T(const txeo::Tensor<T> &)> _loss_func;
+    void verify_parameter(const txeo::TensorView<T> &pred) const;
+    std::function<T(const txeo::TensorView<T> &)> _loss_func;
 };
 
 /**
@@ -151,6 +151,26 @@ class Matrix : public txeo::Tensor<T> {
      */
     explicit Matrix(txeo::Tensor<T> &&tensor);
 
+    /**
+     * @brief Constructs a matrix by evaluating a lazy expression in a single pass
+     *
+     * Requires txeo/TensorExpr.h. See @ref txeo::lazy.
+     *
+     * @param expr Expression to be evaluated
+     */
+    template <typename E>
+      requires c_tensor_expr<E, T>
+    Matrix(const E &expr);
+
+    /**
+     * @brief Evaluates a lazy expression into this matrix in a single pass
+     *
+     * Requires txeo/TensorExpr.h. See @ref txeo::lazy.
+     */
+    template <typename E>
+      requires c_tensor_expr<E, T>
+    Matrix &operator=(const E &expr);
+
     /**
      * @brief Returns the size of the matrix.
      *
@@ -0,0 +1,141 @@
+#ifndef MATRIXBATCHES_H
+#define MATRIXBATCHES_H
+#pragma once
+
+#include "txeo/Matrix.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+
+namespace txeo {
+
+/**
+ * @brief A range of fixed-size row batches read sequentially from a text file
+ *
+ * Only one batch is held in memory at a time, so files larger than the available memory can be
+ * processed. Batches are parsed into a buffer allocated with the first batch and reused by the
+ * following ones; only the last batch of the file, if shorter, gets a buffer of its own. With
+ * prefetching enabled, the next batch is parsed on a background thread while the current one is
+ * processed.
+ *
+ * A batch stays valid until the next one is requested. Every call to @ref begin restarts the file,
+ * so the range can be traversed once per training epoch. Errors are reported as in
+ * @ref txeo::MatrixIO::read_text_file when the offending batch is reached.
+ *
+ * **Example Usage:**
+ * @code
+ * #include "txeo/MatrixIO.h"
+ *
+ * txeo::MatrixIO io{"huge.csv"};
+ * auto batches = io.stream_batches<double>(100000, true);
+ * double total{0.0};
+ * for (const auto &batch : batches)
+ *   total += batch.data()[0];
+ * @endcode
+ *
+ * @tparam T Data type of the matrix elements
+ */
+template <typename T>
+class MatrixBatches {
+  public:
+    MatrixBatches(const MatrixBatches &) = delete;
+    MatrixBatches(MatrixBatches &&) noexcept;
+    MatrixBatches &operator=(const MatrixBatches &) = delete;
+    MatrixBatches &operator=(MatrixBatches &&) noexcept;
+    ~MatrixBatches();
+
+    /**
+     * @brief Constructs a range of batches over a text file
+     *
+     * @param path Path to the file
+     * @param separator Character delimiting each element in a row
+     * @param batch_rows Number of rows of each batch, except possibly the last one
+     * @param has_header Whether the first line contains column headers
+     * @param prefetch Whether the next batch is parsed on a background thread
+     *
+     * @throws MatrixIOError
+     */
+    explicit MatrixBatches(const std::filesystem::path &path, char separator, size_t batch_rows,
+                           bool has_header = false, bool prefetch = false);
+
+    /**
+     * @brief Input iterator over the batches of a @ref txeo::MatrixBatches
+     */
+    class Iterator {
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = txeo::Matrix<T>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const txeo::Matrix<T> *;
+        using reference = const txeo::Matrix<T> &;
+
+        Iterator() = default;
+
+        reference operator*() const { return _batches->batch(); }
+        pointer operator->() const { return &_batches->batch(); }
+
+        Iterator &operator++() {
+          if (!_batches->next())
+            _batches = nullptr;
+          return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        bool operator==(std::default_sentinel_t) const { return _batches == nullptr; }
+
+      private:
+        explicit Iterator(MatrixBatches *batches) : _batches{batches} {}
+
+        MatrixBatches *_batches{nullptr};
+
+        friend class MatrixBatches;
+    };
+
+    /**
+     * @brief Restarts the file and returns an iterator to its first batch
+     *
+     * @throws MatrixIOError
+     */
+    Iterator begin();
+
+    [[nodiscard]] std::default_sentinel_t end() const { return {}; }
+
+    /**
+     * @brief Reads the next batch
+     *
+     * @return false if the end of the file was reached
+     *
+     * @throws MatrixIOError
+     */
+    bool next();
+
+    /**
+     * @brief Restarts the file, so that the next call to @ref next returns its first batch
+     */
+    void rewind();
+
+    /**
+     * @brief Returns the current batch
+     *
+     * @throws MatrixIOError if no batch was read yet
+     */
+    const txeo::Matrix<T> &batch() const;
+
+    [[nodiscard]] size_t batch_rows() const;
+
+    /**
+     * @brief Number of columns of the file, known from construction (zero for a file without rows)
+     */
+    [[nodiscard]] size_t col_size() const;
+
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+} // namespace txeo
+
+#endif
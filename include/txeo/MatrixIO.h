@@ -5,15 +5,14 @@
 #include "txeo/Logger.h"
 #include "txeo/LoggerConsole.h"
 #include "txeo/Matrix.h"
+#include "txeo/MatrixBatches.h"
 
 #include <cstddef>
 #include <filesystem>
-#include <map>
 #include <stdexcept>
-#include <string>
 #include <type_traits>
-#include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace txeo {
 
@@ -40,6 +39,9 @@ class MatrixIO {
     /**
      * @brief Returns a matrix with elements read from a text file
      *
+     * The file is memory mapped and its lines are counted before parsing, so the values are
+     * parsed straight into the matrix without an intermediate buffer.
+     *
      * @tparam T Data type of the matrix elements
      * @param has_header Whether the first line contains column headers
      * @return Matrix<T> Created matrix with data from the file
@@ -57,9 +59,64 @@ class MatrixIO {
     template <typename T>
     txeo::Matrix<T> read_text_file(bool has_header = false) const;
 
+    /**
+     * @brief Returns a matrix with elements read from a text file, parsing it on several threads
+     *
+     * The file is memory mapped and split into ranges of whole lines. The lines of each range are
+     * counted concurrently, which gives every range its row offset in the matrix, and then each
+     * range is parsed on its own thread straight into its rows. Errors are reported as in the
+     * single-threaded overload.
+     *
+     * @tparam T Data type of the matrix elements
+     * @param has_header Whether the first line contains column headers
+     * @param num_threads Number of threads, at most the size of the shared thread pool (zero means
+     * the whole pool; one reads the file sequentially)
+     * @return Matrix<T> Created matrix with data from the file
+     *
+     * @throws MatrixIOError
+     *
+     * @par Example (Parallel read):
+     * @code
+     * txeo::MatrixIO io("features.csv");
+     * auto matrix = io.read_text_file<double>(true, 16); // Parse on 16 threads
+     * @endcode
+     */
+    template <typename T>
+    txeo::Matrix<T> read_text_file(bool has_header, size_t num_threads) const;
+
+    /**
+     * @brief Returns a range of fixed-size row batches read sequentially from the text file
+     *
+     * Only one batch is held in memory at a time, so the file may be larger than the available
+     * memory. See @ref txeo::MatrixBatches.
+     *
+     * @tparam T Data type of the matrix elements
+     * @param batch_rows Number of rows of each batch, except possibly the last one
+     * @param has_header Whether the first line contains column headers
+     * @param prefetch Whether the next batch is parsed on a background thread
+     * @return MatrixBatches<T> Range of batches
+     *
+     * @throws MatrixIOError
+     *
+     * @par Example (Out-of-core processing):
+     * @code
+     * txeo::MatrixIO io("huge.csv");
+     * for (const auto &batch : io.stream_batches<float>(50000, true, true))
+     *   std::cout << "Batch shape: " << batch.shape() << std::endl;
+     * @endcode
+     */
+    template <typename T>
+    txeo::MatrixBatches<T> stream_batches(size_t batch_rows, bool has_header = false,
+                                          bool prefetch = false) const {
+      return txeo::MatrixBatches<T>{_path, _separator, batch_rows, has_header, prefetch};
+    }
+
     /**
      * @brief Writes a matrix to a text file
      *
+     * Floating-point elements are written in the shortest form that reads back to the same value.
+     * Large matrices are formatted on several threads.
+     *
      * @tparam T Data type of the matrix elements
      * @param matrix Matrix to write to file
      *
@@ -95,6 +152,67 @@ class MatrixIO {
       requires(std::is_floating_point_v<T>)
     void write_text_file(const txeo::Matrix<T> &matrix, size_t precision) const;
 
+    /**
+     * @brief Writes a matrix to a compressed columnar file
+     *
+     * Each column is stored as a separate block, so that a subset of the columns can be read
+     * without touching the others. Integer columns are delta encoded, floating-point columns are
+     * byte shuffled, and every block is then compressed with a built-in LZ77 scheme. Columns are
+     * encoded on several threads.
+     *
+     * @tparam T Data type of the matrix elements
+     * @param matrix Matrix to write
+     *
+     * @throws MatrixIOError
+     *
+     * @par Example (Archiving a dataset):
+     * @code
+     * auto data = txeo::MatrixIO::read_textfile<double>("train.csv", ',', true, 0);
+     * txeo::MatrixIO{"train.txcol"}.write_columnar_file(data);
+     * @endcode
+     */
+    template <typename T>
+    void write_columnar_file(const txeo::Matrix<T> &matrix) const;
+
+    /**
+     * @brief Returns a matrix with all the columns of a columnar file
+     *
+     * @tparam T Data type of the matrix elements, which must be the one the file was written with
+     * @return Matrix<T> Created matrix
+     *
+     * @throws MatrixIOError
+     */
+    template <typename T>
+    txeo::Matrix<T> read_columnar_file() const;
+
+    /**
+     * @brief Returns a matrix with some of the columns of a columnar file
+     *
+     * Only the blocks of the requested columns are read from disk and decompressed, so the cost
+     * is proportional to the number of columns requested. Blocks are decoded on several threads.
+     *
+     * @tparam T Data type of the matrix elements, which must be the one the file was written with
+     * @param cols Columns of the file, in the order they take in the matrix
+     * @return Matrix<T> Created matrix, of shape [rows, cols.size()]
+     *
+     * @throws MatrixIOError
+     *
+     * @par Example (Column projection):
+     * @code
+     * txeo::MatrixIO io{"train.txcol"};
+     * auto features = io.read_columnar_file<double>({3, 17, 42});
+     * @endcode
+     */
+    template <typename T>
+    txeo::Matrix<T> read_columnar_file(const std::vector<size_t> &cols) const;
+
+    /**
+     * @brief Returns the number of rows and columns stored in a columnar file
+     *
+     * @throws MatrixIOError
+     */
+    [[nodiscard]] std::pair<size_t, size_t> columnar_file_shape() const;
+
     /**
      * @brief Returns a matrix with elements read from a text file
      *
@@ -102,6 +220,7 @@ class MatrixIO {
      * @param path File path to read from
      * @param separator Column separator character
      * @param has_header Whether to skip first line as header
+     * @param num_threads Number of parsing threads (zero means the whole shared thread pool)
      * @return Matrix<T> Created matrix
      *
      * @par Example (One-time read):
@@ -113,9 +232,9 @@ class MatrixIO {
      */
     template <typename T>
     static txeo::Matrix<T> read_textfile(const std::filesystem::path &path, char separator = ',',
-                                         bool has_header = false) {
+                                         bool has_header = false, size_t num_threads = 1) {
       txeo::MatrixIO io{path, separator};
-      Matrix<T> resp{io.read_text_file<T>(has_header)};
+      Matrix<T> resp{io.read_text_file<T>(has_header, num_threads)};
       return resp;
     };
 
@@ -164,10 +283,56 @@ class MatrixIO {
       io.write_text_file(matrix, precision);
     };
 
+    /**
+     * @brief Writes a matrix to a compressed columnar file
+     *
+     * @tparam T Data type of matrix elements
+     * @param matrix Matrix to write
+     * @param path Output file path
+     *
+     * @par Example (One-time write):
+     * @code
+     * txeo::MatrixIO::write_columnarfile(matrix, "matrix.txcol");
+     * @endcode
+     */
+    template <typename T>
+    static void write_columnarfile(const txeo::Matrix<T> &matrix,
+                                   const std::filesystem::path &path) {
+      txeo::MatrixIO io{path};
+      io.write_columnar_file(matrix);
+    }
+
+    /**
+     * @brief Returns a matrix with some of the columns of a columnar file
+     *
+     * @tparam T Data type of matrix elements
+     * @param path File path to read from
+     * @param cols Columns to read (empty means all of them)
+     * @return Matrix<T> Created matrix
+     *
+     * @par Example (One-time read):
+     * @code
+     * auto labels = txeo::MatrixIO::read_columnarfile<float>("matrix.txcol", {0});
+     * @endcode
+     */
+    template <typename T>
+    static txeo::Matrix<T> read_columnarfile(const std::filesystem::path &path,
+                                             const std::vector<size_t> &cols = {}) {
+      txeo::MatrixIO io{path};
+      return cols.empty() ? io.read_columnar_file<T>() : io.read_columnar_file<T>(cols);
+    }
+
     /**
      * @brief Performs one-hot encoding in all non-numeric columns in a text file and writes the
      * result to a target file.
      *
+     * The categories of each non-numeric column are collected in a single parallel pass over the
+     * memory-mapped source and numbered in sorted order, so the output does not depend on the
+     * order of the rows. Each categorical column `c` is replaced by one column `c_<category>` per
+     * category. The encoded rows are then produced concurrently and written in large blocks.
+     * Only finite numbers are numeric: spellings of NaN and infinity, such as the common "nan"
+     * marker of missing values, are categories.
+     *
      * @param source_path The path to the source text file containing the input data.
      * @param separator The delimiter used in the input file (e.g., ',' for CSV).
      * @param has_header A flag indicating whether the input file has a header row.
@@ -207,17 +372,36 @@ class MatrixIO {
                              bool has_header, const std::filesystem::path &target_path,
                              txeo::Logger &logger = txeo::LoggerConsole::instance());
 
+    /**
+     * @brief Performs one-hot encoding in all non-numeric columns in a text file and returns the
+     * result as a matrix, without an intermediate text file.
+     *
+     * Columns are encoded as in @ref one_hot_encode_text_file. Each range of rows is encoded
+     * concurrently straight into the matrix.
+     *
+     * @tparam T Data type of the matrix elements
+     * @param source_path The path to the source text file containing the input data.
+     * @param separator The delimiter used in the input file (e.g., ',' for CSV).
+     * @param has_header A flag indicating whether the input file has a header row.
+     * @return Matrix<T> Encoded data
+     *
+     * @throws txeo::MatrixIOError
+     *
+     * @par Example (Encoding to a binary tensor file):
+     * @code
+     * auto encoded = txeo::MatrixIO::one_hot_encode_matrix<float>("input.csv", ',', true);
+     * txeo::TensorIO::write_binaryfile(encoded, "input.txeo");
+     * @endcode
+     */
+    template <typename T>
+    static txeo::Matrix<T>
+    one_hot_encode_matrix(const std::filesystem::path &source_path, char separator,
+                          bool has_header, txeo::Logger &logger = txeo::LoggerConsole::instance());
+
   private:
     std::filesystem::path _path;
     char _separator;
     txeo::Logger *_logger{nullptr};
-
-    static std::map<size_t, std::unordered_set<std::string>>
-    build_lookups_map(const std::filesystem::path &source_path, char separator, bool has_header);
-
-    static std::string
-    build_target_header(const std::filesystem::path &source_path, char separator, bool has_header,
-                        const std::map<size_t, std::unordered_set<std::string>> &lookups_map);
 };
 
 /**
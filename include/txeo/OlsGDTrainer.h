@@ -3,6 +3,7 @@
 #pragma once
 
 #include "txeo/Matrix.h"
+#include "txeo/MatrixBatches.h"
 #include "txeo/Tensor.h"
 #include "txeo/TensorShape.h"
 #include "txeo/Trainer.h"
@@ -10,6 +11,7 @@
 #include <concepts>
 #include <cstddef>
 #include <stdexcept>
+#include <vector>
 
 namespace txeo {
 enum class LossFunc;
@@ -121,6 +123,42 @@ class OlsGDTrainer : public txeo::Trainer<T> {
      */
     const txeo::Matrix<T> &weight_bias() const;
 
+    /**
+     * @brief Streams the training data from batches instead of the training matrices of the data
+     * table
+     *
+     * The statistics driving the descent (the Gram matrix of the features and their products with
+     * the outputs) are accumulated batch by batch, so the training data do not need to fit in
+     * memory. The data table must still hold evaluation data, whose loss guides the descent.
+     *
+     * When feature normalization is enabled, the normalization parameters are the ones fitted on
+     * the training matrix of the data table, not on the batches. If the data table holds only a
+     * sample of the streamed data, the sample should cover the range of the features.
+     *
+     * @param batches Batches of the training data, which must outlive the training
+     * @param x_cols Columns of the batches holding the features
+     * @param y_cols Columns of the batches holding the outputs
+     *
+     * @throws OlsGDTrainerError if the data table has no evaluation data, if the numbers of columns
+     * differ from the ones of the data table or if a column is out of range of the batches
+     *
+     * **Example Usage:**
+     * @code
+     * auto batches = txeo::MatrixIO{"train.csv"}.stream_batches<double>(100000, true, true);
+     * txeo::DataTable<double> dt{sample, {0, 1}, std::vector<size_t>{2}, 20};
+     * txeo::OlsGDTrainer<double> trainer{dt};
+     * trainer.set_train_batches(batches, {0, 1}, {2});
+     * trainer.fit(100, txeo::LossFunc::MSE);
+     * @endcode
+     */
+    void set_train_batches(txeo::MatrixBatches<T> &batches, std::vector<size_t> x_cols,
+                           std::vector<size_t> y_cols);
+
+    /**
+     * @brief Trains on the training matrices of the data table again
+     */
+    void clear_train_batches();
+
     /**
      * @brief Gets convergence tolerance
      *
@@ -157,6 +195,10 @@ class OlsGDTrainer : public txeo::Trainer<T> {
     bool _variable_lr{false};
     bool _is_converged{false};
 
+    txeo::MatrixBatches<T> *_train_batches{nullptr};
+    std::vector<size_t> _batch_x_cols;
+    std::vector<size_t> _batch_y_cols;
+
     OlsGDTrainer() = default;
     void train(size_t epochs, txeo::LossFunc metric) override;
 };
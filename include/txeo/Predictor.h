@@ -12,6 +12,7 @@
 #include <filesystem>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace txeo {
 
@@ -66,6 +67,32 @@ class Predictor {
     explicit Predictor(std::filesystem::path model_path,
                        txeo::Logger &logger = txeo::LoggerConsole::instance());
 
+    /**
+     * @brief Constructs a Predictor from a TensorFlow SavedModel directory with specific session
+     * settings
+     *
+     * @param model_path Path to the directory of the .pb saved model
+     * @param config Thread pools, CPU affinity and graph optimizer settings of the session
+     *
+     * @throw PredictorError
+     *
+     * @par Example (Two predictors sharing a host):
+     * @code
+     * txeo::PredictorConfig config{.intra_op_threads = 4,
+     *                              .inter_op_threads = 2,
+     *                              .shared_inter_op_pool = "serving"};
+     * txeo::Predictor<float> ranker{"ranker_model", config};
+     * txeo::Predictor<float> filter{"filter_model", config}; // Same inter-op pool
+     * @endcode
+     */
+    explicit Predictor(std::filesystem::path model_path, const txeo::PredictorConfig &config,
+                       txeo::Logger &logger = txeo::LoggerConsole::instance());
+
+    /**
+     * @brief Returns the session settings of the predictor
+     */
+    [[nodiscard]] const txeo::PredictorConfig &config() const noexcept;
+
     /**
      * @brief Returns the input tensor metadata for the loaded model
      *
@@ -175,6 +202,51 @@ class Predictor {
      */
     [[nodiscard]] std::vector<txeo::Tensor<T>> predict_batch(const TensorIdent &inputs) const;
 
+    /**
+     * @brief Perform inference with multiple named inputs, fetching several outputs in a single run
+     *
+     * The returned tensors share the buffers the model wrote its outputs to, so no element is
+     * copied.
+     *
+     * @param inputs Vector of (name, tensor) pairs
+     * @param output_names Names of the outputs to fetch (empty means all outputs of the model)
+     * @return Vector of output tensors, in the order of @p output_names
+     *
+     * @throw PredictorError
+     *
+     * @par Example:
+     * @code
+     * auto heads = predictor.predict_outputs({{"features", input}},
+     *                                        {"click:0", "purchase:0", "dwell:0"});
+     * @endcode
+     */
+    [[nodiscard]] std::vector<txeo::Tensor<T>>
+    predict_outputs(const TensorIdent &inputs, const std::vector<std::string> &output_names) const;
+
+    /**
+     * @brief Perform inference with multiple named inputs, fetching several outputs in a single run
+     * into existing tensors
+     *
+     * The tensors of @p outputs are reused across calls: each one is rebound to the buffer the
+     * model wrote the corresponding output to, without copying elements or creating tensor
+     * objects. Missing tensors are appended and extra ones removed.
+     *
+     * @param inputs Vector of (name, tensor) pairs
+     * @param output_names Names of the outputs to fetch (empty means all outputs of the model)
+     * @param outputs Output tensors, in the order of @p output_names
+     *
+     * @throw PredictorError
+     *
+     * @par Example:
+     * @code
+     * std::vector<txeo::Tensor<float>> heads;
+     * for (const auto &request : requests)
+     *   predictor.predict_outputs({{"features", request}}, {"click:0", "purchase:0"}, heads);
+     * @endcode
+     */
+    void predict_outputs(const TensorIdent &inputs, const std::vector<std::string> &output_names,
+                         std::vector<txeo::Tensor<T>> &outputs) const;
+
     /**
      * @brief Enable/disable XLA (Accelerated Linear Algebra) compilation
      * @param enable Whether to enable XLA optimizations
@@ -189,6 +261,58 @@ class Predictor {
      */
     void enable_xla(bool enable);
 
+    /**
+     * @brief Enable/disable the pre-bound fast path of inference calls (enabled by default)
+     *
+     * When enabled, the feeds and fetches of each combination of input and output names are
+     * resolved once by the session (TensorFlow callables), so that inference calls pass their
+     * tensors by position instead of looking names up in the graph. The callable of
+     * @ref predict is created when the model is loaded, the ones of @ref predict_batch on first
+     * use. When disabled, every call runs the session with named feeds.
+     *
+     * @param enable Whether inference calls use pre-bound callables
+     */
+    void enable_callables(bool enable);
+
+    /**
+     * @brief Runs synthetic inputs through the model, so that later calls do not pay for lazy
+     * kernel initialization or XLA compilation
+     *
+     * A zero-filled tensor is built for every model input from its metadata: the first unknown
+     * dimension takes each batch size in turn and the other unknown dimensions are one. The timings
+     * of the first and last runs of each batch size are logged, showing the cold-start cost.
+     *
+     * Setting @ref txeo::PredictorConfig::warmup_batch_sizes runs the warmup after every load,
+     * including the reloads of @ref enable_xla.
+     *
+     * @param batch_sizes Batch sizes to warm up; each one is compiled separately by XLA
+     * @param runs Runs of each batch size
+     *
+     * @throw PredictorError
+     *
+     * @par Example:
+     * @code
+     * txeo::Predictor<float> predictor{"model_dir"};
+     * predictor.enable_xla(true);
+     * predictor.warmup({1, 32, 128});
+     * @endcode
+     */
+    void warmup(const std::vector<size_t> &batch_sizes = {1}, size_t runs = 2);
+
+    /**
+     * @brief Runs representative inputs through the model, so that later calls do not pay for
+     * lazy kernel initialization or XLA compilation
+     *
+     * With a single input, the runs go through the path of @ref predict; otherwise, and when the
+     * model has several outputs, through the one of @ref predict_outputs fetching all outputs.
+     *
+     * @param inputs Vector of (name, tensor) pairs
+     * @param runs Number of runs
+     *
+     * @throw PredictorError
+     */
+    void warmup_inputs(const TensorIdent &inputs, size_t runs = 2);
+
   private:
     struct Impl;
     std::unique_ptr<Impl> _impl{nullptr};
@@ -0,0 +1,134 @@
+#ifndef PREDICTORPOOL_H
+#define PREDICTORPOOL_H
+#pragma once
+
+#include "txeo/Logger.h"
+#include "txeo/LoggerConsole.h"
+#include "txeo/Predictor.h"
+#include "txeo/Tensor.h"
+#include "types.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace txeo {
+
+/**
+ * @brief Pool of replicas of a model serving concurrent inference calls
+ *
+ * Every replica is a @ref txeo::Predictor with a session of its own, so concurrent calls do not
+ * contend on one session. Idle replicas wait in a lock-free queue; each call takes one, runs on it
+ * and gives it back. Calls made while all replicas are busy wait for the first one released.
+ *
+ * Replicas are loaded with the same @ref txeo::PredictorConfig. Giving them a shared inter-op pool
+ * and a bounded number of intra-op threads keeps the total number of threads under control.
+ *
+ * **Example Usage:**
+ * @code
+ * txeo::PredictorConfig config{.intra_op_threads = 2, .shared_inter_op_pool = "serving"};
+ * txeo::PredictorPool<float> pool{"model_dir", 8, config};
+ *
+ * // From any number of threads
+ * auto output = pool.predict(input);
+ *
+ * for (const auto &stats : pool.replica_stats())
+ *   std::cout << stats.calls << " calls, " << 100 * stats.utilization << "% busy\n";
+ * @endcode
+ *
+ * @tparam T Specifies the data type of the model involved
+ */
+template <typename T = float>
+class PredictorPool {
+  public:
+    /**
+     * @brief Usage of a replica since the pool was created
+     */
+    struct ReplicaStats {
+        /**
+         * @brief Number of inference calls run on the replica
+         *
+         */
+        size_t calls{0};
+
+        /**
+         * @brief Time spent running inference calls, in seconds
+         *
+         */
+        double busy_seconds{0.0};
+
+        /**
+         * @brief Fraction of the lifetime of the pool spent running inference calls
+         *
+         */
+        double utilization{0.0};
+    };
+
+    PredictorPool(const PredictorPool &) = delete;
+    PredictorPool(PredictorPool &&) = delete;
+    PredictorPool &operator=(const PredictorPool &) = delete;
+    PredictorPool &operator=(PredictorPool &&) = delete;
+    ~PredictorPool();
+
+    /**
+     * @brief Loads the replicas of a TensorFlow SavedModel
+     *
+     * @param model_path Path to the directory of the .pb saved model
+     * @param replicas Number of replicas
+     * @param config Session settings of every replica
+     *
+     * @throw PredictorError
+     */
+    explicit PredictorPool(const std::filesystem::path &model_path, size_t replicas,
+                           const txeo::PredictorConfig &config = {},
+                           txeo::Logger &logger = txeo::LoggerConsole::instance());
+
+    /**
+     * @brief Perform single input/single output inference on an idle replica
+     *
+     * @see txeo::Predictor::predict
+     *
+     * @throw PredictorError
+     */
+    [[nodiscard]] txeo::Tensor<T> predict(const txeo::Tensor<T> &input) const;
+
+    /**
+     * @brief Perform inference with multiple named inputs and outputs on an idle replica
+     *
+     * @see txeo::Predictor::predict_outputs
+     *
+     * @throw PredictorError
+     */
+    [[nodiscard]] std::vector<txeo::Tensor<T>>
+    predict_outputs(const typename txeo::Predictor<T>::TensorIdent &inputs,
+                    const std::vector<std::string> &output_names) const;
+
+    /**
+     * @brief Returns the number of replicas
+     */
+    [[nodiscard]] size_t size() const;
+
+    /**
+     * @brief Returns a replica, e.g. to read its metadata
+     *
+     * @param index Index of the replica, less than @ref size
+     *
+     * @throw PredictorError
+     */
+    [[nodiscard]] const txeo::Predictor<T> &replica(size_t index) const;
+
+    /**
+     * @brief Returns the usage of each replica since the pool was created
+     */
+    [[nodiscard]] std::vector<ReplicaStats> replica_stats() const;
+
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl{nullptr};
+};
+
+} // namespace txeo
+
+#endif
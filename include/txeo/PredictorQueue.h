@@ -0,0 +1,107 @@
+#ifndef PREDICTORQUEUE_H
+#define PREDICTORQUEUE_H
+#pragma once
+
+#include "txeo/Predictor.h"
+#include "txeo/Tensor.h"
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+
+namespace txeo {
+
+/**
+ * @brief Asynchronous front end of a @ref txeo::Predictor that batches concurrent requests
+ *
+ * Single-row requests submitted from any number of threads are queued and answered through
+ * futures. A worker thread merges the pending requests into one batch, runs the model once for the
+ * whole batch and hands each caller its row of the output. A batch is run as soon as it reaches
+ * the maximum batch size, or when its oldest request has waited for the maximum waiting time.
+ *
+ * The model must have a variable batch axis, i.e., the first axis of its first input must be
+ * unknown. The predictor must outlive the queue.
+ *
+ * **Example Usage:**
+ * @code
+ * txeo::Predictor<float> predictor{"model_dir"};
+ * txeo::PredictorQueue<float> queue{predictor, 64, std::chrono::microseconds{200}};
+ *
+ * // From any thread
+ * auto future = queue.submit(txeo::Tensor<float>({11}, features));
+ * auto output = future.get(); // Row of the output, here of shape (1)
+ * @endcode
+ *
+ * @tparam T Specifies the data type of the model involved
+ */
+template <typename T = float>
+class PredictorQueue {
+  public:
+    PredictorQueue(const PredictorQueue &) = delete;
+    PredictorQueue(PredictorQueue &&) = delete;
+    PredictorQueue &operator=(const PredictorQueue &) = delete;
+    PredictorQueue &operator=(PredictorQueue &&) = delete;
+
+    /**
+     * @brief Stops the worker after answering the pending requests
+     */
+    ~PredictorQueue();
+
+    /**
+     * @brief Constructs a queue and starts its worker thread
+     *
+     * @param predictor Predictor running the batches
+     * @param max_batch_size Maximum number of requests merged into a batch
+     * @param max_wait Maximum time a request waits for other requests to join its batch
+     *
+     * @throws PredictorError
+     */
+    explicit PredictorQueue(const txeo::Predictor<T> &predictor, size_t max_batch_size = 64,
+                            std::chrono::microseconds max_wait = std::chrono::microseconds{500});
+
+    /**
+     * @brief Queues a single-row request
+     *
+     * @param row Input row, whose shape is the model input shape without the batch axis
+     * @return Future of the corresponding output row, whose shape is the model output shape
+     * without the batch axis. Errors raised while running the batch are stored in the future.
+     *
+     * @throws PredictorError if the shape of the row does not match the model input
+     *
+     * @par Example:
+     * @code
+     * std::vector<std::future<txeo::Tensor<float>>> futures;
+     * for (const auto &row : rows)
+     *   futures.emplace_back(queue.submit(row));
+     * for (auto &future : futures)
+     *   std::cout << future.get() << std::endl;
+     * @endcode
+     */
+    [[nodiscard]] std::future<txeo::Tensor<T>> submit(txeo::Tensor<T> row);
+
+    [[nodiscard]] size_t max_batch_size() const;
+
+    [[nodiscard]] std::chrono::microseconds max_wait() const;
+
+    /**
+     * @brief Returns the number of batches run so far
+     */
+    [[nodiscard]] size_t batch_count() const;
+
+    /**
+     * @brief Returns the number of requests answered so far
+     *
+     * A request is counted before its future becomes ready, so the count read after a future
+     * returns includes the request of that future.
+     */
+    [[nodiscard]] size_t request_count() const;
+
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl{nullptr};
+};
+
+} // namespace txeo
+
+#endif
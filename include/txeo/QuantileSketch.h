@@ -0,0 +1,118 @@
+#ifndef QUANTILESKETCH_H
+#define QUANTILESKETCH_H
+#pragma once
+
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace txeo {
+
+/**
+ * @brief Streaming sketch of the distribution of a sequence, answering approximate quantiles in
+ * bounded memory
+ *
+ * Values go to a hierarchy of compactors (a KLL sketch). When a level is full it is sorted and
+ * every other value is promoted to the next level with twice the weight, so the sketch retains
+ * O(k log(n / k)) values for n insertions. The rank error of a quantile is about 1.7 / k of the
+ * count with high probability; the minimum and the maximum are kept exactly.
+ *
+ * Sketches built over separate parts of a sequence can be merged, which lets the parts be
+ * processed in parallel.
+ *
+ * **Example Usage:**
+ * @code
+ * txeo::QuantileSketch<double> sketch{400};
+ * for (const auto &value : column)
+ *   sketch.insert(value);
+ * auto [p01, median, p99] = sketch.quantiles({0.01, 0.5, 0.99});
+ * @endcode
+ *
+ * @tparam T Type of the values
+ */
+template <typename T>
+class QuantileSketch {
+  public:
+    /**
+     * @brief Constructs an empty sketch
+     *
+     * @param k Capacity of the top compactor, which sets the accuracy (at least 8)
+     *
+     * @throw QuantileSketchError
+     */
+    explicit QuantileSketch(size_t k = 200);
+
+    /**
+     * @brief Adds a value to the sketch
+     */
+    void insert(const T &value);
+
+    /**
+     * @brief Adds the values of another sketch, built with the same @p k
+     *
+     * @throw QuantileSketchError
+     */
+    void merge(const QuantileSketch &other);
+
+    /**
+     * @brief Returns the approximate quantile of the inserted values
+     *
+     * @param q Quantile, in [0, 1]
+     *
+     * @throw QuantileSketchError
+     */
+    [[nodiscard]] T quantile(double q) const;
+
+    /**
+     * @brief Returns several approximate quantiles, sorting the retained values once
+     *
+     * @param qs Quantiles, each one in [0, 1]
+     * @return Quantiles in the order of @p qs
+     *
+     * @throw QuantileSketchError
+     */
+    [[nodiscard]] std::vector<T> quantiles(const std::vector<double> &qs) const;
+
+    /**
+     * @brief Returns the number of inserted values
+     */
+    [[nodiscard]] size_t count() const noexcept { return _count; }
+
+    /**
+     * @brief Returns the number of values retained by the sketch
+     */
+    [[nodiscard]] size_t retained() const noexcept;
+
+    /**
+     * @brief Returns the capacity of the top compactor
+     */
+    [[nodiscard]] size_t k() const noexcept { return _k; }
+
+  private:
+    size_t _k;
+    size_t _count{0};
+    size_t _retained{0};
+    size_t _max_retained{0};
+    T _min{};
+    T _max{};
+    std::vector<std::vector<T>> _levels;
+    std::minstd_rand _random;
+
+    [[nodiscard]] size_t capacity(size_t level) const;
+    void update_max_retained();
+    void compress();
+};
+
+/**
+ * @brief Exceptions concerning @ref txeo::QuantileSketch
+ *
+ */
+class QuantileSketchError : public std::runtime_error {
+  public:
+    using std::runtime_error::runtime_error;
+};
+
+} // namespace txeo
+
+#endif
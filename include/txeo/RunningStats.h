@@ -0,0 +1,118 @@
+#ifndef RUNNINGSTATS_H
+#define RUNNINGSTATS_H
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace txeo {
+
+/**
+ * @brief One-pass accumulator of the count, sum, mean, variance, minimum and maximum of a sequence
+ *
+ * Values are accumulated in double precision whatever the element type. Buffers are pushed in
+ * blocks small enough to stay in L1 cache: the mean and the sum of squared deviations of a block
+ * are computed from the cached values and folded into the running moments with the pairwise
+ * update of Chan et al., so memory is read once and the result does not drift as the count
+ * grows. Accumulators of separate parts of a sequence can be merged with the same update, which
+ * lets the parts be processed by different threads.
+ *
+ * **Example Usage:**
+ * @code
+ * txeo::RunningStats<float> stats;
+ * for (const auto &batch : batches)
+ *   stats.push(batch.data(), batch.dim());
+ * std::cout << stats.mean() << " +- " << stats.standard_deviation() << "\n";
+ * @endcode
+ *
+ * @tparam T Type of the values
+ */
+template <typename T>
+class RunningStats {
+  public:
+    /**
+     * @brief Adds a value
+     */
+    void push(const T &value);
+
+    /**
+     * @brief Adds the elements of a buffer
+     *
+     * @details Large buffers are split in fixed-size chunks accumulated across the shared thread
+     * pool and merged in order, so the result does not depend on the number of threads.
+     *
+     * @param data First element
+     * @param size Number of elements
+     * @param stride Distance between consecutive elements
+     */
+    void push(const T *data, size_t size, size_t stride = 1);
+
+    /**
+     * @brief Adds the elements of a vector
+     */
+    void push(const std::vector<T> &values);
+
+    /**
+     * @brief Adds the values accumulated by another instance
+     */
+    void merge(const RunningStats &other);
+
+    /**
+     * @brief Returns the number of values
+     */
+    [[nodiscard]] size_t count() const noexcept { return _count; }
+
+    /**
+     * @brief Returns the sum, accumulated in double precision (zero when empty)
+     */
+    [[nodiscard]] T sum() const;
+
+    /**
+     * @brief Returns the mean (zero when empty)
+     */
+    [[nodiscard]] T mean() const;
+
+    /**
+     * @brief Returns the sample variance, dividing by count - 1 (zero for less than two values)
+     */
+    [[nodiscard]] T variance() const;
+
+    /**
+     * @brief Returns the population variance, dividing by count (zero when empty)
+     */
+    [[nodiscard]] T population_variance() const;
+
+    /**
+     * @brief Returns the square root of the sample variance
+     */
+    [[nodiscard]] T standard_deviation() const;
+
+    /**
+     * @brief Returns the square root of the population variance
+     */
+    [[nodiscard]] T population_standard_deviation() const;
+
+    /**
+     * @brief Returns the smallest value (zero when empty)
+     */
+    [[nodiscard]] T min() const noexcept { return _min; }
+
+    /**
+     * @brief Returns the largest value (zero when empty)
+     */
+    [[nodiscard]] T max() const noexcept { return _max; }
+
+  private:
+    size_t _count{0};
+    double _sum{0.0};
+    double _mean{0.0};
+    double _m2{0.0};
+    T _min{};
+    T _max{};
+
+    void fold(size_t count, double sum, double m2, const T &min, const T &max);
+};
+
+} // namespace txeo
+
+#endif
@@ -24,6 +24,13 @@ enum class NormalizationType;
 template <typename T>
 concept c_numeric = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
 
+/**
+ * @brief Satisfied by the lazy expressions of txeo/TensorExpr.h whose elements have type T
+ */
+template <typename E, typename T>
+concept c_tensor_expr =
+    requires { typename E::is_tensor_expr; } && std::same_as<typename E::value_type, T>;
+
 namespace detail {
 class TensorHelper;
 }
@@ -51,14 +58,15 @@ class Tensor {
   public:
     explicit Tensor();
     /**
-     * @note This copy constructor performs a deep copy, behaving differently from TensorFlow C++.
+     * @note The copy shares the buffer of @p tensor, which is only duplicated when one of them is
+     * first modified through a mutating accessor (copy on write).
      */
     Tensor(const Tensor &tensor);
     Tensor(Tensor &&tensor) noexcept;
     virtual ~Tensor();
 
     /**
-     * @note This copy assignment performs a deep copy, behaving differently from TensorFlow C++.
+     * @note The buffer of @p tensor is shared until one of them is modified (copy on write).
      */
     Tensor &operator=(const Tensor &tensor);
     Tensor &operator=(Tensor &&tensor) noexcept;
@@ -486,7 +494,7 @@ class Tensor {
 
     /**
      * @brief Views the content of the specified tensor according to the specified shape. There is
-     * no element copying.
+     * no element copying. Modifying either tensor afterwards detaches it from the other.
      *
      * @param tensor Viewed tensor
      * @param shape  New shape of this tensor
@@ -1017,6 +1025,9 @@ class Tensor {
     /**
      * @brief Acesses the raw data of this tensor
      *
+     * @details If the buffer is shared with other tensors, it is first duplicated so that writes
+     * do not affect them. Pointers obtained from previous calls are invalidated in this case.
+     *
      * @return T*
      */
     T *data();
@@ -1033,7 +1044,7 @@ class Tensor {
      *
      * @return Tensor<T> A clone of this tensor
      *
-     * @note A copy is performed
+     * @note Elements are copied lazily, when either tensor is first modified
      */
     Tensor<T> clone() const;
 
@@ -1179,6 +1190,43 @@ class Tensor {
     Tensor<T> &operator*=(const T &scalar);
     Tensor<T> &operator/=(const T &scalar);
 
+    /**
+     * @brief Constructs a tensor by evaluating a lazy expression in a single pass
+     *
+     * Expressions are created with @ref txeo::lazy, defined in txeo/TensorExpr.h, which must be
+     * included to use this constructor and the expression assignments below.
+     *
+     * @param expr Expression to be evaluated
+     *
+     * **Example Usage:**
+     * @code
+     * txeo::Tensor<double> a({3}, {1.0, 2.0, 3.0});
+     * txeo::Tensor<double> b({3}, {4.0, 5.0, 6.0});
+     * txeo::Tensor<double> c = 2.0 * txeo::lazy(a) + b; // [6.0, 9.0, 12.0], no temporaries
+     * @endcode
+     */
+    template <typename E>
+      requires c_tensor_expr<E, T>
+    Tensor(const E &expr);
+
+    /**
+     * @brief Evaluates a lazy expression into this tensor in a single pass
+     *
+     * The buffer of this tensor is reused when its shape matches the shape of the expression. The
+     * expression may refer to this tensor.
+     */
+    template <typename E>
+      requires c_tensor_expr<E, T>
+    Tensor &operator=(const E &expr);
+
+    template <typename E>
+      requires c_tensor_expr<E, T>
+    Tensor &operator+=(const E &expr);
+
+    template <typename E>
+      requires c_tensor_expr<E, T>
+    Tensor &operator-=(const E &expr);
+
     txeo::TensorIterator<T> begin();
     txeo::TensorIterator<T> end();
     txeo::TensorIterator<const T> begin() const;
@@ -1207,6 +1255,10 @@ class Tensor {
         std::vector<T> &flat_data, std::vector<size_t> &shape);
 
     void check_indexes(const std::vector<size_t> &indexes);
+
+    void share_from(const Tensor<T> &tensor);
+
+    void detach();
 };
 
 /**
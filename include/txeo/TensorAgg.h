@@ -3,10 +3,10 @@
 #pragma once
 
 #include "txeo/Tensor.h"
+#include "txeo/TensorView.h"
 
 #include <concepts>
 #include <cstddef>
-#include <functional>
 #include <stdexcept>
 #include <vector>
 
@@ -47,6 +47,29 @@ class TensorAgg {
     static txeo::Tensor<T> reduce_sum(const txeo::Tensor<T> &tensor,
                                       const std::vector<size_t> &axes);
 
+    /**
+     * @brief Computes the sum of the elements of a view along the specified axes.
+     *
+     * @details The reduction runs natively over the viewed elements, so slices and column subsets
+     * of a tensor are reduced without being copied.
+     *
+     * @param view The input view (tensors convert implicitly).
+     * @param axes The axes along which to compute the sum.
+     * @return A new tensor containing the sum along the specified axes.
+     *
+     * @throws txeo::TensorAggError
+     *
+     * **Example Usage:**
+     * @code
+     * txeo::Matrix<int> data(3, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+     * txeo::TensorView<int> view{data};
+     * auto result = TensorAgg<int>::reduce_sum(view.cols({0, 2}), {0});
+     * // result = [12, 18]
+     * @endcode
+     */
+    static txeo::Tensor<T> reduce_sum(const txeo::TensorView<T> &view,
+                                      const std::vector<size_t> &axes);
+
     /**
      * @brief Computes the product of tensor elements along the specified axes.
      *
@@ -81,6 +104,18 @@ class TensorAgg {
     static txeo::Tensor<T> reduce_mean(const txeo::Tensor<T> &tensor,
                                        const std::vector<size_t> &axes);
 
+    /**
+     * @brief Computes the mean of the elements of a view along the specified axes.
+     *
+     * @param view The input view (tensors convert implicitly).
+     * @param axes The axes along which to compute the mean.
+     * @return A new tensor containing the mean along the specified axes.
+     *
+     * @throws txeo::TensorAggError
+     */
+    static txeo::Tensor<T> reduce_mean(const txeo::TensorView<T> &view,
+                                       const std::vector<size_t> &axes);
+
     /**
      * @brief Computes the maximum of tensor elements along the specified axes.
      *
@@ -151,6 +186,12 @@ class TensorAgg {
     /**
      * @brief Computes the variance of tensor elements along the specified axis.
      *
+     * The sample variance (dividing by the count minus one) is computed in double precision and
+     * converted to T at the end. For integral types the mean is therefore not truncated: the
+     * variance of {0, 3} is 4 (from 4.5), where integer arithmetic around a mean of 1 would give 5.
+     * Along an axis of length 1 the result is the element itself, unlike the zero variance
+     * reported by @ref describe.
+     *
      * @param tensor The input tensor.
      * @param axis The axis along which to compute the variance.
      * @return A new tensor containing the variance along the specified axis.
@@ -167,6 +208,8 @@ class TensorAgg {
     /**
      * @brief Computes the standard deviation of tensor elements along the specified axis.
      *
+     * The square root of @ref reduce_variance, which is converted to T before the root is taken.
+     *
      * @param tensor The input tensor.
      * @param axis The axis along which to compute the standard deviation.
      * @return A new tensor containing the standard deviation along the specified axis.
@@ -196,6 +239,57 @@ class TensorAgg {
      */
     static txeo::Tensor<T> reduce_median(const txeo::Tensor<T> &tensor, size_t axis);
 
+    /**
+     * @brief Computes several quantiles of tensor elements along the specified axis.
+     *
+     * @details Each fiber is copied once and the ranks the quantiles need are selected in
+     * ascending order, in linear expected time instead of sorting. Quantiles between two ranks
+     * are linearly interpolated (truncated for integer types).
+     *
+     * @param tensor The input tensor.
+     * @param axis The axis along which to compute the quantiles.
+     * @param quantiles The quantiles to compute, each one in [0, 1].
+     * @return A new tensor with the shape of the input without @p axis, followed by one axis
+     * holding the quantiles in the order of @p quantiles.
+     *
+     * @throws txeo::TensorAggError
+     *
+     * **Example Usage:**
+     * @code
+     * txeo::Tensor<double> tensor({2, 5}, {1., 2., 3., 4., 5., 10., 20., 30., 40., 50.});
+     * auto result = TensorAgg<double>::reduce_quantiles(tensor, 1, {0.25, 0.5});
+     * // result = [[2, 3], [20, 30]]
+     * @endcode
+     */
+    static txeo::Tensor<T> reduce_quantiles(const txeo::Tensor<T> &tensor, size_t axis,
+                                            const std::vector<double> &quantiles);
+
+    /**
+     * @brief Computes approximate quantiles of tensor elements along the specified axis, for
+     * axes too long to be copied and partitioned.
+     *
+     * @details Each fiber is streamed into a @ref txeo::QuantileSketch, so memory stays bounded
+     * whatever the length of the axis. When there are fewer fibers than threads, segments of each
+     * fiber are sketched in parallel and the sketches merged.
+     *
+     * @param tensor The input tensor.
+     * @param axis The axis along which to compute the quantiles.
+     * @param quantiles The quantiles to compute, each one in [0, 1].
+     * @param sketch_capacity Accuracy of the sketches (rank error about 1.7 / capacity).
+     * @return A new tensor with the shape of the input without @p axis, followed by one axis
+     * holding the quantiles in the order of @p quantiles.
+     *
+     * @throws txeo::TensorAggError
+     *
+     * **Example Usage:**
+     * @code
+     * auto result = TensorAgg<float>::reduce_quantiles_approx(columns, 0, {0.01, 0.5, 0.99});
+     * @endcode
+     */
+    static txeo::Tensor<T> reduce_quantiles_approx(const txeo::Tensor<T> &tensor, size_t axis,
+                                                   const std::vector<double> &quantiles,
+                                                   size_t sketch_capacity = 200);
+
     /**
      * @brief Computes the geometric mean of tensor elements along the specified axis.
      *
@@ -329,9 +423,85 @@ class TensorAgg {
     static txeo::Tensor<size_t> count_non_zero(const txeo::Tensor<T> &tensor, size_t axis);
 
     /**
-     * @brief Computes the sum of all elements in the tensor.
+     * @brief Summary statistics of the fibers of a tensor along an axis, see @ref describe.
+     *
+     * Every member has the shape of the tensor without the described axis.
+     */
+    struct Description {
+        /**
+         * @brief Smallest value
+         *
+         */
+        txeo::Tensor<T> min;
+
+        /**
+         * @brief Largest value
+         *
+         */
+        txeo::Tensor<T> max;
+
+        /**
+         * @brief Sum of the values
+         *
+         */
+        txeo::Tensor<T> sum;
+
+        /**
+         * @brief Mean of the values
+         *
+         */
+        txeo::Tensor<T> mean;
+
+        /**
+         * @brief Sample variance of the values, dividing by count - 1
+         *
+         * A fiber with a single value has a variance of 0. This differs from
+         * @ref reduce_variance, which returns the element itself along an axis of length 1.
+         */
+        txeo::Tensor<T> variance;
+
+        /**
+         * @brief Number of non-zero elements, NaN included
+         *
+         */
+        txeo::Tensor<size_t> non_zero;
+
+        /**
+         * @brief Number of NaN elements
+         *
+         */
+        txeo::Tensor<size_t> nan;
+    };
+
+    /**
+     * @brief Computes the minimum, maximum, sum, mean, variance, non-zero count and NaN count
+     * along the specified axis in a single pass over the tensor.
+     *
+     * Fibers that are adjacent in memory are scanned together in cache-sized tiles, and long
+     * fibers are split in segments whose partial statistics are merged, so all the statistics of
+     * a feature table cost one parallel scan instead of one reduction each. NaN elements are
+     * counted in @ref Description::nan and left out of the other statistics. A fiber made only of
+     * NaN elements has a zero sum and NaN minimum, maximum, mean and variance.
      *
      * @param tensor The input tensor.
+     * @param axis The axis along which to describe the tensor.
+     * @return The statistics of the fibers along the specified axis.
+     *
+     * @throw TensorAggError
+     *
+     * **Example Usage:**
+     * @code
+     * txeo::Tensor<double> table({3, 2}, {1.0, 10.0, 2.0, 0.0, 3.0, 20.0});
+     * auto result = TensorAgg<double>::describe(table, 0);
+     * // result.mean = [2.0, 10.0], result.variance = [1.0, 100.0], result.non_zero = [3, 2]
+     * @endcode
+     */
+    static Description describe(const txeo::Tensor<T> &tensor, size_t axis);
+
+    /**
+     * @brief Computes the sum of all elements in the tensor.
+     *
+     * @param tensor The input tensor (or any view of a tensor).
      * @return The sum of all elements in the tensor.
      *
      * **Example Usage:**
@@ -341,18 +511,18 @@ class TensorAgg {
      * // result = 21  (sum of all elements)
      * @endcode
      */
-    static T sum_all(const txeo::Tensor<T> &tensor);
+    static T sum_all(const txeo::TensorView<T> &tensor);
 
   private:
     TensorAgg() = default;
 
     static void verify_parameters(const txeo::Tensor<T> &tensor, const std::vector<size_t> &axes);
 
-    static txeo::Tensor<T> accumulate(const txeo::Tensor<T> &tensor, size_t axis,
-                                      std::function<T(std::vector<T> &)>);
+    template <typename F>
+    static txeo::Tensor<T> accumulate(const txeo::Tensor<T> &tensor, size_t axis, F acc_fun);
 
-    static txeo::Tensor<size_t> count(const txeo::Tensor<T> &tensor, size_t axis,
-                                      std::function<size_t(std::vector<T> &)>);
+    template <typename F>
+    static txeo::Tensor<size_t> count(const txeo::Tensor<T> &tensor, size_t axis, F count_fun);
 
     static T median(std::vector<T> &values);
     static T geometric_mean(std::vector<T> &values);
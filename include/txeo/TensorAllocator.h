@@ -0,0 +1,241 @@
+#ifndef TENSORALLOCATOR_H
+#define TENSORALLOCATOR_H
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace txeo {
+
+namespace detail {
+class AllocatorAdapter;
+}
+
+/**
+ * @brief Allocation counters of a @ref txeo::TensorAllocator
+ *
+ */
+struct AllocatorStats {
+    size_t allocations{0};       ///< Buffers handed out
+    size_t deallocations{0};     ///< Buffers given back
+    size_t reuses{0};            ///< Buffers served without requesting memory from the system
+    size_t bytes_in_use{0};      ///< Bytes of the buffers currently handed out
+    size_t peak_bytes_in_use{0}; ///< Maximum of bytes_in_use since construction
+};
+
+/**
+ * @class TensorAllocator
+ * @brief Interface of the allocators that provide the element buffers of tensors.
+ *
+ * By default, tensors take their buffers from the TensorFlow CPU allocator. While a @ref
+ * txeo::AllocatorScope is alive, tensors constructed on the same thread take their buffers from
+ * the allocator of the scope instead. Buffers are always given back to the allocator that provided
+ * them, whatever thread releases the tensor.
+ *
+ * Derived classes implement @ref allocate and @ref deallocate; the counters returned by @ref stats
+ * are maintained by this class.
+ *
+ * @note An allocator must outlive the tensors created with it. @ref txeo::PoolAllocator is never
+ * destroyed and @ref txeo::TensorArena defers the release of its memory until its last buffer is
+ * given back, so both are safe in this respect.
+ */
+class TensorAllocator {
+  public:
+    TensorAllocator(const TensorAllocator &) = delete;
+    TensorAllocator(TensorAllocator &&) = delete;
+    TensorAllocator &operator=(const TensorAllocator &) = delete;
+    TensorAllocator &operator=(TensorAllocator &&) = delete;
+    virtual ~TensorAllocator();
+
+    /**
+     * @brief Returns a block of at least @p bytes bytes aligned to @p alignment
+     */
+    virtual void *allocate(size_t bytes, size_t alignment) = 0;
+
+    /**
+     * @brief Gives back a block returned by @ref allocate with the same size and alignment
+     */
+    virtual void deallocate(void *ptr, size_t bytes, size_t alignment) = 0;
+
+    /**
+     * @brief Name of this allocator
+     */
+    [[nodiscard]] virtual std::string name() const = 0;
+
+    /**
+     * @brief Returns a snapshot of the allocation counters
+     */
+    [[nodiscard]] AllocatorStats stats() const;
+
+  protected:
+    TensorAllocator();
+
+    /**
+     * @brief Counts a buffer served without requesting memory from the system
+     */
+    void record_reuse();
+
+    /**
+     * @brief Hands the release of this allocator's memory over to its last outstanding buffer
+     *
+     * Meant to be called from the destructor of a derived class. If no buffer is outstanding,
+     * @p release runs immediately; otherwise it runs when the last buffer is given back.
+     */
+    void retire(std::function<void()> release);
+
+  private:
+    detail::AllocatorAdapter *_adapter{nullptr};
+
+    friend class detail::AllocatorAdapter;
+};
+
+/**
+ * @class PoolAllocator
+ * @brief Process wide allocator that recycles buffers through thread-local size-class pools.
+ *
+ * Requests are rounded up to one of four size classes per power of two. Released buffers are
+ * kept in a free list of the releasing thread and handed out again to tensors of the same size
+ * class, so loops creating and destroying temporaries of a few fixed shapes stop hitting the
+ * system allocator. Requests larger than @ref max_pooled_bytes bypass the pools.
+ *
+ * **Example Usage:**
+ * @code
+ * #include "txeo/TensorAllocator.h"
+ *
+ * {
+ *   txeo::AllocatorScope scope{txeo::PoolAllocator::instance()};
+ *   for (size_t i{0}; i < 1000; ++i) {
+ *     txeo::Matrix<double> tmp(100, 100, 1.0); // buffer recycled after the first iteration
+ *   }
+ * }
+ * auto stats = txeo::PoolAllocator::instance().stats();
+ * std::cout << stats.reuses << " of " << stats.allocations << " buffers reused" << std::endl;
+ * @endcode
+ */
+class PoolAllocator : public TensorAllocator {
+  public:
+    /**
+     * @brief Largest request served by the pools (64 MiB)
+     */
+    static constexpr size_t max_pooled_bytes = size_t{1} << 26;
+
+    /**
+     * @brief Maximum number of free buffers kept per size class and thread
+     */
+    static constexpr size_t max_cached_blocks = 16;
+
+    /**
+     * @brief Returns the process wide pool
+     */
+    static PoolAllocator &instance();
+
+    void *allocate(size_t bytes, size_t alignment) override;
+    void deallocate(void *ptr, size_t bytes, size_t alignment) override;
+    [[nodiscard]] std::string name() const override { return "txeo_pool"; }
+
+    /**
+     * @brief Returns the free buffers cached by the calling thread to the system
+     */
+    void trim();
+
+  private:
+    PoolAllocator() = default;
+};
+
+/**
+ * @class TensorArena
+ * @brief Bump-pointer allocator whose buffers are all released together.
+ *
+ * Buffers are carved out of large chunks and individual deallocations are only counted. The chunks
+ * are released when the arena is destroyed or, if tensors created with it are still alive at that
+ * point, when the last of them is destroyed. An arena is not thread-safe: it must be used by a
+ * single thread at a time.
+ *
+ * **Example Usage:**
+ * @code
+ * #include "txeo/TensorAllocator.h"
+ *
+ * txeo::Matrix<double> result;
+ * {
+ *   txeo::TensorArena arena;
+ *   txeo::AllocatorScope scope{arena};
+ *   auto a = x.dot(w);                // temporaries live in the arena
+ *   auto b = a - y;
+ *   result = b.clone();               // shares the arena buffer, kept alive after the scope
+ * }
+ * @endcode
+ */
+class TensorArena : public TensorAllocator {
+  public:
+    /**
+     * @brief Constructs an arena
+     *
+     * @param chunk_bytes Size of the chunks carved by the arena. Larger requests get a chunk of
+     * their own.
+     */
+    explicit TensorArena(size_t chunk_bytes = size_t{1} << 22);
+    ~TensorArena() override;
+
+    void *allocate(size_t bytes, size_t alignment) override;
+    void deallocate(void *ptr, size_t bytes, size_t alignment) override;
+    [[nodiscard]] std::string name() const override { return "txeo_arena"; }
+
+    /**
+     * @brief Total bytes reserved by the chunks of this arena
+     */
+    [[nodiscard]] size_t reserved_bytes() const { return _reserved; }
+
+  private:
+    struct Chunk {
+        std::unique_ptr<std::byte[]> memory;
+        size_t size{0};
+    };
+
+    size_t _chunk_bytes;
+    size_t _reserved{0};
+    size_t _offset{0};
+    size_t _live{0};
+    std::vector<Chunk> _chunks;
+};
+
+/**
+ * @class AllocatorScope
+ * @brief Makes an allocator the source of the buffers of tensors created on this thread.
+ *
+ * Scopes nest: the previous allocator is restored when the scope ends.
+ */
+class AllocatorScope {
+  public:
+    explicit AllocatorScope(TensorAllocator &allocator);
+    AllocatorScope(const AllocatorScope &) = delete;
+    AllocatorScope(AllocatorScope &&) = delete;
+    AllocatorScope &operator=(const AllocatorScope &) = delete;
+    AllocatorScope &operator=(AllocatorScope &&) = delete;
+    ~AllocatorScope();
+
+    /**
+     * @brief Returns the allocator of the innermost scope of this thread, or nullptr if there is
+     * none
+     */
+    static TensorAllocator *current();
+
+  private:
+    TensorAllocator *_previous{nullptr};
+};
+
+/**
+ * @brief Exceptions concerning @ref txeo::TensorAllocator
+ *
+ */
+class TensorAllocatorError : public std::runtime_error {
+  public:
+    using std::runtime_error::runtime_error;
+};
+
+} // namespace txeo
+
+#endif
@@ -0,0 +1,481 @@
+#ifndef TENSOREXPR_H
+#define TENSOREXPR_H
+#pragma once
+
+#include "txeo/Matrix.h"
+#include "txeo/Tensor.h"
+#include "txeo/TensorOp.h"
+#include "txeo/TensorShape.h"
+#include "txeo/Vector.h"
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace txeo {
+
+namespace detail {
+
+template <typename U>
+U tensor_element(const txeo::Tensor<U> *);
+
+/**
+ * @brief Satisfied by txeo::Tensor and its derived classes (txeo::Matrix, txeo::Vector)
+ */
+template <typename X>
+concept c_tensor = requires(std::remove_cvref_t<X> *ptr) { detail::tensor_element(ptr); };
+
+/**
+ * @brief Satisfied by any lazy tensor expression
+ */
+template <typename X>
+concept c_expr = requires { typename std::remove_cvref_t<X>::is_tensor_expr; };
+
+template <typename X>
+struct operand_value {
+    using type = typename std::remove_cvref_t<X>::value_type;
+};
+
+template <c_tensor X>
+struct operand_value<X> {
+    using type = decltype(detail::tensor_element(std::declval<std::remove_cvref_t<X> *>()));
+};
+
+template <typename X>
+using operand_value_t = typename operand_value<X>::type;
+
+/**
+ * @brief Satisfied by a tensor and an expression, or two expressions, of the same element type
+ */
+template <typename L, typename R>
+concept c_expr_operands = (c_tensor<L> || c_expr<L>) && (c_tensor<R> || c_expr<R>) &&
+                          (c_expr<L> || c_expr<R>) &&
+                          std::same_as<operand_value_t<L>, operand_value_t<R>>;
+
+/**
+ * @brief Satisfied by an expression and a scalar convertible to its element type
+ */
+template <typename E, typename S>
+concept c_expr_scalar = c_expr<E> && std::is_arithmetic_v<std::remove_cvref_t<S>>;
+
+struct Plus {
+    template <typename T>
+    static T apply(T left, T right) {
+      return static_cast<T>(left + right);
+    }
+};
+
+struct Minus {
+    template <typename T>
+    static T apply(T left, T right) {
+      return static_cast<T>(left - right);
+    }
+};
+
+struct Multiplies {
+    template <typename T>
+    static T apply(T left, T right) {
+      return static_cast<T>(left * right);
+    }
+};
+
+struct Divides {
+    template <typename T>
+    static T apply(T left, T right) {
+      return static_cast<T>(left / right);
+    }
+};
+
+template <typename T>
+bool is_zero_element(T value) {
+  if constexpr (std::is_floating_point_v<T>)
+    return (value < 0 ? -value : value) < std::numeric_limits<T>::epsilon();
+  else
+    return value == T{0};
+}
+
+template <typename E>
+void check_operand(const E &expr) {
+  if (expr.shape().calculate_capacity() == 0)
+    throw TensorOpError("One of the operands has dimension zero.");
+}
+
+template <typename E>
+void check_divisor(const E &expr) {
+  auto size = expr.shape().calculate_capacity();
+  for (size_t i{0}; i < size; ++i)
+    if (detail::is_zero_element(expr[i]))
+      throw TensorOpError("Zero element in right operand.");
+}
+
+} // namespace detail
+
+/**
+ * @brief Leaf of a lazy expression that refers to an existing tensor
+ *
+ * The tensor must outlive the expression. Use @ref txeo::lazy to create one.
+ */
+template <typename T>
+class TensorRefExpr {
+  public:
+    using value_type = T;
+    using is_tensor_expr = void;
+
+    explicit TensorRefExpr(const Tensor<T> &tensor)
+        : _data{tensor.data()}, _shape{&tensor.shape()} {};
+
+    T operator[](size_t i) const { return _data[i]; }
+    [[nodiscard]] const TensorShape &shape() const { return *_shape; }
+
+  private:
+    const T *_data;
+    const TensorShape *_shape;
+};
+
+/**
+ * @brief Leaf of a lazy expression that owns a temporary tensor
+ *
+ * Created when an rvalue tensor, such as the result of a matrix product, takes part in an
+ * expression, so that the expression can be stored without dangling.
+ */
+template <typename T>
+class TensorValueExpr {
+  public:
+    using value_type = T;
+    using is_tensor_expr = void;
+
+    explicit TensorValueExpr(Tensor<T> &&tensor)
+        : _tensor{std::move(tensor)}, _data{_tensor.data()} {};
+
+    TensorValueExpr(const TensorValueExpr &expr)
+        : _tensor{expr._tensor}, _data{_tensor.data()} {};
+
+    TensorValueExpr(TensorValueExpr &&expr) noexcept
+        : _tensor{std::move(expr._tensor)}, _data{_tensor.data()} {};
+
+    T operator[](size_t i) const { return _data[i]; }
+    [[nodiscard]] const TensorShape &shape() const { return _tensor.shape(); }
+
+  private:
+    Tensor<T> _tensor;
+    const T *_data;
+};
+
+/**
+ * @brief Lazy element-wise operation between two expressions of the same shape
+ */
+template <typename Op, typename L, typename R>
+class BinaryExpr {
+  public:
+    using value_type = typename L::value_type;
+    using is_tensor_expr = void;
+
+    BinaryExpr(L left, R right) : _left{std::move(left)}, _right{std::move(right)} {
+      detail::check_operand(_left);
+      detail::check_operand(_right);
+      if (_left.shape() != _right.shape())
+        throw TensorOpError("Operands have different shapes.");
+      if constexpr (std::is_same_v<Op, detail::Divides>)
+        detail::check_divisor(_right);
+    };
+
+    value_type operator[](size_t i) const { return Op::apply(_left[i], _right[i]); }
+    [[nodiscard]] const TensorShape &shape() const { return _left.shape(); }
+
+  private:
+    L _left;
+    R _right;
+};
+
+/**
+ * @brief Lazy element-wise operation between an expression and a scalar on its right
+ */
+template <typename Op, typename L>
+class ScalarRightExpr {
+  public:
+    using value_type = typename L::value_type;
+    using is_tensor_expr = void;
+
+    ScalarRightExpr(L left, value_type right) : _left{std::move(left)}, _right{right} {
+      detail::check_operand(_left);
+      if constexpr (std::is_same_v<Op, detail::Divides>)
+        if (detail::is_zero_element(_right))
+          throw TensorOpError("Denominator is zero.");
+    };
+
+    value_type operator[](size_t i) const { return Op::apply(_left[i], _right); }
+    [[nodiscard]] const TensorShape &shape() const { return _left.shape(); }
+
+  private:
+    L _left;
+    value_type _right;
+};
+
+/**
+ * @brief Lazy element-wise operation between a scalar on the left and an expression
+ */
+template <typename Op, typename R>
+class ScalarLeftExpr {
+  public:
+    using value_type = typename R::value_type;
+    using is_tensor_expr = void;
+
+    ScalarLeftExpr(value_type left, R right) : _left{left}, _right{std::move(right)} {
+      detail::check_operand(_right);
+      if constexpr (std::is_same_v<Op, detail::Divides>)
+        detail::check_divisor(_right);
+    };
+
+    value_type operator[](size_t i) const { return Op::apply(_left, _right[i]); }
+    [[nodiscard]] const TensorShape &shape() const { return _right.shape(); }
+
+  private:
+    value_type _left;
+    R _right;
+};
+
+/**
+ * @brief Starts a lazy expression from a tensor
+ *
+ * Arithmetic operators applied to the result build an expression tree instead of computing
+ * intermediate tensors. The tree is evaluated in a single fused loop, with no temporary buffers,
+ * when it is assigned to or used to construct a txeo::Tensor, txeo::Matrix or txeo::Vector. Shapes
+ * and divisors are checked when each node is built, so errors are reported at the same point as
+ * with the eager operators.
+ *
+ * An lvalue tensor is referenced and must outlive the expression. An rvalue tensor is moved into
+ * the expression.
+ *
+ * @param tensor Tensor starting the expression
+ * @return Leaf expression
+ *
+ * **Example Usage:**
+ * @code
+ * txeo::Matrix<double> b(2, 2, {1.0, 2.0, 3.0, 4.0});
+ * txeo::Matrix<double> k(2, 2, {0.5, 0.5, 0.5, 0.5});
+ *
+ * // One pass over the data and no intermediate matrices
+ * txeo::Matrix<double> c = txeo::lazy(b) - 0.1 * (txeo::lazy(b.dot(b)) - k);
+ *
+ * // In-place update, also fused
+ * b -= 0.1 * (txeo::lazy(b.dot(b)) - k);
+ * @endcode
+ */
+template <typename T>
+TensorRefExpr<T> lazy(const Tensor<T> &tensor) {
+  return TensorRefExpr<T>{tensor};
+}
+
+template <typename T>
+TensorValueExpr<T> lazy(Tensor<T> &&tensor) {
+  return TensorValueExpr<T>{std::move(tensor)};
+}
+
+namespace detail {
+
+template <typename X>
+auto to_expr(X &&operand) {
+  if constexpr (c_expr<X>)
+    return std::remove_cvref_t<X>{std::forward<X>(operand)};
+  else if constexpr (std::is_lvalue_reference_v<X>)
+    return TensorRefExpr<operand_value_t<X>>{operand};
+  else
+    return TensorValueExpr<operand_value_t<X>>{std::move(operand)};
+}
+
+template <typename Op, typename L, typename R>
+auto make_binary(L &&left, R &&right) {
+  auto l_expr = detail::to_expr(std::forward<L>(left));
+  auto r_expr = detail::to_expr(std::forward<R>(right));
+  return BinaryExpr<Op, decltype(l_expr), decltype(r_expr)>{std::move(l_expr),
+                                                             std::move(r_expr)};
+}
+
+template <typename Op, typename L, typename S>
+auto make_scalar_right(L &&left, const S &right) {
+  auto l_expr = detail::to_expr(std::forward<L>(left));
+  using value_type = typename decltype(l_expr)::value_type;
+  return ScalarRightExpr<Op, decltype(l_expr)>{std::move(l_expr), static_cast<value_type>(right)};
+}
+
+template <typename Op, typename S, typename R>
+auto make_scalar_left(const S &left, R &&right) {
+  auto r_expr = detail::to_expr(std::forward<R>(right));
+  using value_type = typename decltype(r_expr)::value_type;
+  return ScalarLeftExpr<Op, decltype(r_expr)>{static_cast<value_type>(left), std::move(r_expr)};
+}
+
+} // namespace detail
+
+template <typename L, typename R>
+  requires detail::c_expr_operands<L, R>
+auto operator+(L &&left, R &&right) {
+  return detail::make_binary<detail::Plus>(std::forward<L>(left), std::forward<R>(right));
+}
+
+template <typename L, typename R>
+  requires detail::c_expr_operands<L, R>
+auto operator-(L &&left, R &&right) {
+  return detail::make_binary<detail::Minus>(std::forward<L>(left), std::forward<R>(right));
+}
+
+template <typename L, typename R>
+  requires detail::c_expr_operands<L, R>
+auto operator*(L &&left, R &&right) {
+  return detail::make_binary<detail::Multiplies>(std::forward<L>(left), std::forward<R>(right));
+}
+
+template <typename L, typename R>
+  requires detail::c_expr_operands<L, R>
+auto operator/(L &&left, R &&right) {
+  return detail::make_binary<detail::Divides>(std::forward<L>(left), std::forward<R>(right));
+}
+
+template <typename E, typename S>
+  requires detail::c_expr_scalar<E, S>
+auto operator+(E &&left, const S &right) {
+  return detail::make_scalar_right<detail::Plus>(std::forward<E>(left), right);
+}
+
+template <typename S, typename E>
+  requires detail::c_expr_scalar<E, S>
+auto operator+(const S &left, E &&right) {
+  return detail::make_scalar_left<detail::Plus>(left, std::forward<E>(right));
+}
+
+template <typename E, typename S>
+  requires detail::c_expr_scalar<E, S>
+auto operator-(E &&left, const S &right) {
+  return detail::make_scalar_right<detail::Minus>(std::forward<E>(left), right);
+}
+
+template <typename S, typename E>
+  requires detail::c_expr_scalar<E, S>
+auto operator-(const S &left, E &&right) {
+  return detail::make_scalar_left<detail::Minus>(left, std::forward<E>(right));
+}
+
+template <typename E, typename S>
+  requires detail::c_expr_scalar<E, S>
+auto operator*(E &&left, const S &right) {
+  return detail::make_scalar_right<detail::Multiplies>(std::forward<E>(left), right);
+}
+
+template <typename S, typename E>
+  requires detail::c_expr_scalar<E, S>
+auto operator*(const S &left, E &&right) {
+  return detail::make_scalar_left<detail::Multiplies>(left, std::forward<E>(right));
+}
+
+template <typename E, typename S>
+  requires detail::c_expr_scalar<E, S>
+auto operator/(E &&left, const S &right) {
+  return detail::make_scalar_right<detail::Divides>(std::forward<E>(left), right);
+}
+
+template <typename S, typename E>
+  requires detail::c_expr_scalar<E, S>
+auto operator/(const S &left, E &&right) {
+  return detail::make_scalar_left<detail::Divides>(left, std::forward<E>(right));
+}
+
+// Evaluation of expressions into tensors. Each one is a single loop over the elements, so the
+// whole expression tree is computed without intermediate buffers.
+
+namespace detail {
+
+template <typename T, typename E, typename Op>
+void evaluate_into(Tensor<T> &tensor, const E &expr) {
+  auto *data = tensor.data();
+  auto size = tensor.dim();
+  for (size_t i{0}; i < size; ++i)
+    data[i] = Op::apply(data[i], expr[i]);
+}
+
+struct Assign {
+    template <typename T>
+    static T apply(T, T right) {
+      return right;
+    }
+};
+
+} // namespace detail
+
+template <typename T>
+template <typename E>
+  requires c_tensor_expr<E, T>
+Tensor<T>::Tensor(const E &expr) : Tensor{expr.shape()} {
+  detail::evaluate_into<T, E, detail::Assign>(*this, expr);
+}
+
+template <typename T>
+template <typename E>
+  requires c_tensor_expr<E, T>
+Tensor<T> &Tensor<T>::operator=(const E &expr) {
+  // An expression never refers to a tensor of a different shape, so reallocating is safe
+  if (this->shape() != expr.shape())
+    *this = Tensor<T>{expr.shape()};
+  detail::evaluate_into<T, E, detail::Assign>(*this, expr);
+  return *this;
+}
+
+template <typename T>
+template <typename E>
+  requires c_tensor_expr<E, T>
+Tensor<T> &Tensor<T>::operator+=(const E &expr) {
+  if (this->shape() != expr.shape())
+    throw TensorOpError("Operands have different shapes.");
+  detail::evaluate_into<T, E, detail::Plus>(*this, expr);
+  return *this;
+}
+
+template <typename T>
+template <typename E>
+  requires c_tensor_expr<E, T>
+Tensor<T> &Tensor<T>::operator-=(const E &expr) {
+  if (this->shape() != expr.shape())
+    throw TensorOpError("Operands have different shapes.");
+  detail::evaluate_into<T, E, detail::Minus>(*this, expr);
+  return *this;
+}
+
+template <typename T>
+template <typename E>
+  requires c_tensor_expr<E, T>
+Matrix<T>::Matrix(const E &expr) : Tensor<T>{expr} {
+  if (this->order() != 2)
+    throw MatrixError("Tensor does not have order two.");
+}
+
+template <typename T>
+template <typename E>
+  requires c_tensor_expr<E, T>
+Matrix<T> &Matrix<T>::operator=(const E &expr) {
+  if (expr.shape().number_of_axes() != 2)
+    throw MatrixError("Tensor does not have order two.");
+  Tensor<T>::operator=(expr);
+  return *this;
+}
+
+template <typename T>
+template <typename E>
+  requires c_tensor_expr<E, T>
+Vector<T>::Vector(const E &expr) : Tensor<T>{expr} {
+  if (this->order() != 1)
+    throw VectorError("Tensor does not have order one.");
+}
+
+template <typename T>
+template <typename E>
+  requires c_tensor_expr<E, T>
+Vector<T> &Vector<T>::operator=(const E &expr) {
+  if (expr.shape().number_of_axes() != 1)
+    throw VectorError("Tensor does not have order one.");
+  Tensor<T>::operator=(expr);
+  return *this;
+}
+
+} // namespace txeo
+
+#endif
@@ -13,8 +13,26 @@
 namespace txeo {
 
 /**
- * @brief This class is deprecated. Please use class txeo::MatrixIO
+ * @brief Reads and writes tensors in the binary txeo format
  *
+ * A binary tensor file holds a header with the element type, the shape and the alignment of the
+ * data, followed by the raw elements in row-major order. The data section starts at a multiple of
+ * @ref binary_alignment, so that a memory mapping of the file can serve as the tensor buffer.
+ *
+ * The text file functions of this class are deprecated. Please use class txeo::MatrixIO for text
+ * files.
+ *
+ * **Example Usage:**
+ * @code
+ * #include "txeo/TensorIO.h"
+ *
+ * txeo::Tensor<float> features({1000000, 128}, 1.0f);
+ * txeo::TensorIO io{"features.txeo"};
+ * io.write_binary_file(features);
+ *
+ * auto copy = io.read_binary_file<float>(); // reads the data into a new buffer
+ * auto mapped = io.map_binary_file<float>(); // pages are loaded on first access
+ * @endcode
  */
 
 class TensorIO {
@@ -61,6 +79,75 @@ class TensorIO {
       io.write_text_file(tensor, precision);
     };
 
+    /**
+     * @brief Alignment in bytes of the data section of binary files
+     */
+    static constexpr size_t binary_alignment = 64;
+
+    /**
+     * @brief Writes a tensor to a binary file
+     *
+     * @tparam T Data type of the tensor elements
+     * @param tensor Tensor to write
+     *
+     * @throws TensorIOError
+     */
+    template <typename T>
+    void write_binary_file(const txeo::Tensor<T> &tensor) const;
+
+    /**
+     * @brief Returns a tensor with the elements read from a binary file
+     *
+     * @tparam T Data type of the tensor elements, which must match the type recorded in the file
+     * @return txeo::Tensor<T> Tensor owning a copy of the file data
+     *
+     * @throws TensorIOError
+     */
+    template <typename T>
+    txeo::Tensor<T> read_binary_file() const;
+
+    /**
+     * @brief Returns a tensor whose buffer is a memory mapping of a binary file
+     *
+     * No element is read upfront: pages are loaded by the operating system as they are accessed.
+     * The mapping is private, so writing to the tensor never modifies the file. It is released
+     * when the last tensor sharing the buffer is destroyed.
+     *
+     * @tparam T Data type of the tensor elements, which must match the type recorded in the file
+     * @return txeo::Tensor<T> Tensor backed by the mapped file
+     *
+     * @throws TensorIOError
+     */
+    template <typename T>
+    txeo::Tensor<T> map_binary_file() const;
+
+    /**
+     * @brief Writes a tensor to a binary file
+     *
+     * @tparam T Data type of the tensor elements
+     * @param tensor Tensor to write
+     * @param path Output file path
+     */
+    template <typename T>
+    static void write_binaryfile(const txeo::Tensor<T> &tensor, const std::filesystem::path &path) {
+      txeo::TensorIO io{path};
+      io.write_binary_file(tensor);
+    }
+
+    /**
+     * @brief Returns a tensor with the elements read from a binary file
+     *
+     * @tparam T Data type of the tensor elements
+     * @param path File path to read from
+     * @param mapped Whether the tensor buffer is a memory mapping of the file
+     * @return txeo::Tensor<T> Created tensor
+     */
+    template <typename T>
+    static txeo::Tensor<T> read_binaryfile(const std::filesystem::path &path, bool mapped = false) {
+      txeo::TensorIO io{path};
+      return mapped ? io.map_binary_file<T>() : io.read_binary_file<T>();
+    }
+
   private:
     std::filesystem::path _path;
     char _separator;
@@ -4,6 +4,7 @@
 
 #include "txeo/Matrix.h"
 #include "txeo/Tensor.h"
+#include "txeo/TensorView.h"
 #include "txeo/Vector.h"
 
 #include <stdexcept>
@@ -369,6 +370,58 @@ class TensorOp {
      */
     static T inner(const txeo::Tensor<T> &left, const txeo::Tensor<T> &right);
 
+    /**
+     * @brief Returns the sum of two views
+     *
+     * @details Operands are read in place, so slices and column subsets of large tensors can be
+     * combined without copying them first. Tensors, matrices and vectors convert implicitly to
+     * views.
+     *
+     * @param left Left operand
+     * @param right Right operand
+     * @return txeo::Tensor<T> Result, with the shape of the operands
+     *
+     * @exception TensorOpError Thrown if shapes mismatch
+     *
+     * **Example Usage:**
+     * @code
+     * txeo::Matrix<float> data(4, 2, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f});
+     * txeo::TensorView<float> view{data};
+     * auto c = TensorOp<float>::sum(view.rows(0, 2), view.rows(2, 4)); // [[6,8],[10,12]]
+     * @endcode
+     */
+    static txeo::Tensor<T> sum(const txeo::TensorView<T> &left, const txeo::TensorView<T> &right);
+
+    /**
+     * @brief Returns the difference of two views
+     *
+     * @exception TensorOpError Thrown if shapes mismatch
+     */
+    static txeo::Tensor<T> subtract(const txeo::TensorView<T> &left,
+                                    const txeo::TensorView<T> &right);
+
+    /**
+     * @brief Returns the element-wise product of two views
+     *
+     * @exception TensorOpError Thrown if shapes mismatch
+     */
+    static txeo::Tensor<T> hadamard_prod(const txeo::TensorView<T> &left,
+                                         const txeo::TensorView<T> &right);
+
+    /**
+     * @brief Returns the multiplication of a view and a scalar
+     *
+     * @exception TensorOpError Thrown if the view is empty
+     */
+    static txeo::Tensor<T> multiply(const txeo::TensorView<T> &left, const T &right);
+
+    /**
+     * @brief Computes the inner product of two views
+     *
+     * @throws txeo::TensorOpError
+     */
+    static T inner(const txeo::TensorView<T> &left, const txeo::TensorView<T> &right);
+
     /**
      * @brief Computes the matrix product of two second order tensors.
      *
@@ -4,6 +4,7 @@
 
 #include "txeo/Matrix.h"
 #include "txeo/Tensor.h"
+#include "txeo/TensorView.h"
 
 #include <cstddef>
 #include <stdexcept>
@@ -145,7 +146,10 @@ class TensorPart {
     /**
      * @brief Creates a submatrix containing specified columns
      *
-     * @param matrix Source matrix
+     * @details Elements are gathered straight from the source, so a row range of a larger matrix
+     * can be passed as a view without being copied first.
+     *
+     * @param matrix Source matrix (or a second order view)
      * @param cols Vector of column indices to select
      * @return New matrix with selected columns
      * @throws TensorPartError
@@ -159,13 +163,13 @@ class TensorPart {
      * // [4.4, 6.6]
      * @endcode
      */
-    static txeo::Matrix<T> sub_matrix_cols(const txeo::Matrix<T> &matrix,
+    static txeo::Matrix<T> sub_matrix_cols(const txeo::TensorView<T> &matrix,
                                            const std::vector<size_t> &cols);
 
     /**
      * @brief Creates a submatrix excluding the specified columns
      *
-     * @param matrix Source matrix
+     * @param matrix Source matrix (or a second order view)
      * @param cols Vector of column indices to exclude
      * @return New matrix with excluded columns
      *
@@ -180,7 +184,7 @@ class TensorPart {
      * // [5.5]
      * @endcode
      */
-    static txeo::Matrix<T> sub_matrix_cols_exclude(const txeo::Matrix<T> &matrix,
+    static txeo::Matrix<T> sub_matrix_cols_exclude(const txeo::TensorView<T> &matrix,
                                                    const std::vector<size_t> &cols);
 
     /**
@@ -0,0 +1,269 @@
+#ifndef TENSORVIEW_H
+#define TENSORVIEW_H
+#pragma once
+
+#include "txeo/Matrix.h"
+#include "txeo/Tensor.h"
+#include "txeo/TensorShape.h"
+
+#include <concepts>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace txeo {
+
+/**
+ * @class TensorView
+ * @brief A non-owning, read-only window over the elements of a tensor.
+ *
+ * A view holds a pointer to the first element, a shape and the stride (in elements) of each axis.
+ * Row ranges, axis steps and arbitrary index selections (e.g. a subset of columns) are expressed by
+ * adjusting these fields, so no element is ever copied until @ref to_tensor or @ref to_matrix is
+ * called. @ref txeo::Tensor, @ref txeo::Matrix and @ref txeo::Vector convert implicitly to a view,
+ * which makes views accepted wherever a function takes a `const TensorView<T> &`.
+ *
+ * The viewed tensor must outlive the view and must not be reshaped, reassigned or written while
+ * the view is in use, since writing to a tensor whose buffer is shared detaches it.
+ *
+ * @tparam T The data type of the tensor elements (e.g., int, double).
+ *
+ * **Example Usage:**
+ * @code
+ * #include "txeo/TensorView.h"
+ *
+ * txeo::Matrix<double> data(4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+ * txeo::TensorView<double> view{data};
+ *
+ * auto train = view.rows(0, 3);          // rows 0, 1 and 2, no copy
+ * auto labels = train.cols({2});         // last column of those rows, no copy
+ * auto odd = view.slice(0, 0, 4, 2);     // rows 0 and 2
+ *
+ * txeo::Matrix<double> y = labels.to_matrix(); // {{3}, {6}, {9}}
+ * @endcode
+ */
+template <typename T>
+class TensorView {
+  public:
+    TensorView(const TensorView &) = default;
+    TensorView(TensorView &&) = default;
+    TensorView &operator=(const TensorView &) = default;
+    TensorView &operator=(TensorView &&) = default;
+    ~TensorView() = default;
+
+    /**
+     * @brief Constructs a view over all the elements of a tensor
+     *
+     * @param tensor Viewed tensor (also accepts matrices and vectors)
+     */
+    TensorView(const txeo::Tensor<T> &tensor);
+
+    /**
+     * @brief Constructs a view over a row-major buffer
+     *
+     * @param data Pointer to the first element
+     * @param shape Shape of the view
+     */
+    TensorView(const T *data, const txeo::TensorShape &shape);
+
+    /**
+     * @brief Constructs a view over a strided buffer
+     *
+     * @param data Pointer to the first element
+     * @param shape Shape of the view
+     * @param strides Distance, in elements, between consecutive indexes of each axis
+     *
+     * @throws TensorViewError
+     */
+    TensorView(const T *data, const txeo::TensorShape &shape, std::vector<size_t> strides);
+
+    /**
+     * @brief Returns the pointer to the first element of the view
+     */
+    [[nodiscard]] const T *data() const { return _data; }
+
+    /**
+     * @brief Returns the shape of the view
+     */
+    [[nodiscard]] const txeo::TensorShape &shape() const { return _shape; }
+
+    /**
+     * @brief Returns the stride, in elements, of each axis
+     *
+     * @note Axes restricted by @ref select do not use their stride.
+     */
+    [[nodiscard]] const std::vector<size_t> &strides() const { return _strides; }
+
+    /**
+     * @brief Returns the number of axes of the view
+     */
+    [[nodiscard]] size_t order() const { return _dims.size(); }
+
+    /**
+     * @brief Returns the number of elements of the view
+     */
+    [[nodiscard]] size_t dim() const { return _dim; }
+
+    /**
+     * @brief Informs whether the elements of the view are adjacent and in row-major order
+     */
+    [[nodiscard]] bool is_contiguous() const;
+
+    /**
+     * @brief Accesses an element of the view. Indexes are not checked.
+     *
+     * @param args One index for each axis
+     */
+    template <typename... Args>
+      requires(std::convertible_to<Args, size_t> && ...)
+    const T &operator()(Args... args) const {
+      size_t indexes[] = {static_cast<size_t>(args)...};
+      size_t offset{0};
+      for (size_t i{0}; i < sizeof...(Args); ++i)
+        offset += this->axis_offset(i, indexes[i]);
+      return _data[offset];
+    }
+
+    /**
+     * @brief Returns a view of the indexes [first, last) of an axis, taking one every @p step
+     *
+     * @param axis Sliced axis
+     * @param first First index (inclusive)
+     * @param last Last index (exclusive)
+     * @param step Distance between taken indexes
+     *
+     * @throws TensorViewError
+     *
+     * **Example Usage:**
+     * @code
+     * txeo::Tensor<int> t({2, 6}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+     * auto even_cols = txeo::TensorView<int>{t}.slice(1, 0, 6, 2); // {{0, 2, 4}, {6, 8, 10}}
+     * @endcode
+     */
+    [[nodiscard]] TensorView slice(size_t axis, size_t first, size_t last, size_t step = 1) const;
+
+    /**
+     * @brief Returns a view of the rows [first, last), i.e., a slice of the first axis
+     *
+     * @throws TensorViewError
+     */
+    [[nodiscard]] TensorView rows(size_t first, size_t last) const {
+      return this->slice(0, first, last);
+    }
+
+    /**
+     * @brief Returns a view of the specified indexes of an axis, in the given order
+     *
+     * @param axis Restricted axis
+     * @param indexes Indexes kept (repetitions are allowed)
+     *
+     * @throws TensorViewError
+     */
+    [[nodiscard]] TensorView select(size_t axis, const std::vector<size_t> &indexes) const;
+
+    /**
+     * @brief Returns a view of the specified columns, i.e., a selection on the second axis
+     *
+     * @throws TensorViewError
+     */
+    [[nodiscard]] TensorView cols(const std::vector<size_t> &indexes) const {
+      return this->select(1, indexes);
+    }
+
+    /**
+     * @brief Visits the elements in row-major order
+     *
+     * @param func Callable receiving the row-major position of the element in the view and its
+     * value
+     */
+    template <typename F>
+    void for_each(F &&func) const;
+
+    /**
+     * @brief Copies the viewed elements into a new tensor
+     */
+    [[nodiscard]] txeo::Tensor<T> to_tensor() const;
+
+    /**
+     * @brief Copies the viewed elements into a new matrix
+     *
+     * @throws TensorViewError
+     */
+    [[nodiscard]] txeo::Matrix<T> to_matrix() const;
+
+  private:
+    const T *_data{nullptr};
+    txeo::TensorShape _shape;
+    std::vector<size_t> _dims;
+    std::vector<size_t> _strides;
+    std::vector<std::vector<size_t>> _offsets;
+    size_t _dim{0};
+
+    [[nodiscard]] size_t axis_offset(size_t axis, size_t index) const {
+      return _offsets[axis].empty() ? index * _strides[axis] : _offsets[axis][index];
+    }
+
+    void set_dims(std::vector<size_t> &&dims);
+};
+
+/**
+ * @brief Exceptions concerning @ref txeo::TensorView
+ *
+ */
+class TensorViewError : public std::runtime_error {
+  public:
+    using std::runtime_error::runtime_error;
+};
+
+template <typename T>
+template <typename F>
+void TensorView<T>::for_each(F &&func) const {
+  if (_dim == 0)
+    return;
+  if (this->is_contiguous()) {
+    for (size_t i{0}; i < _dim; ++i)
+      func(i, _data[i]);
+    return;
+  }
+
+  // Odometer over the outer axes; the innermost axis is walked by the tight loop
+  auto last = _dims.size() - 1;
+  auto inner_size = _dims[last];
+  std::vector<size_t> index(last, 0);
+  size_t flat{0};
+  size_t base{0};
+  for (size_t axis{0}; axis < last; ++axis)
+    base += this->axis_offset(axis, 0);
+  while (true) {
+    if (_offsets[last].empty()) {
+      auto stride = _strides[last];
+      for (size_t j{0}; j < inner_size; ++j)
+        func(flat++, _data[base + j * stride]);
+    } else {
+      auto *offsets = _offsets[last].data();
+      for (size_t j{0}; j < inner_size; ++j)
+        func(flat++, _data[base + offsets[j]]);
+    }
+
+    size_t axis{last};
+    while (axis > 0) {
+      --axis;
+      base -= this->axis_offset(axis, index[axis]);
+      if (++index[axis] < _dims[axis]) {
+        base += this->axis_offset(axis, index[axis]);
+        break;
+      }
+      index[axis] = 0;
+      base += this->axis_offset(axis, 0);
+      if (axis == 0)
+        return;
+    }
+    if (last == 0)
+      return;
+  }
+}
+
+} // namespace txeo
+
+#endif
@@ -137,6 +137,26 @@ class Vector : public txeo::Tensor<T> {
      */
     explicit Vector(txeo::Tensor<T> &&tensor);
 
+    /**
+     * @brief Constructs a vector by evaluating a lazy expression in a single pass
+     *
+     * Requires txeo/TensorExpr.h. See @ref txeo::lazy.
+     *
+     * @param expr Expression to be evaluated
+     */
+    template <typename E>
+      requires c_tensor_expr<E, T>
+    Vector(const E &expr);
+
+    /**
+     * @brief Evaluates a lazy expression into this vector in a single pass
+     *
+     * Requires txeo/TensorExpr.h. See @ref txeo::lazy.
+     */
+    template <typename E>
+      requires c_tensor_expr<E, T>
+    Vector &operator=(const E &expr);
+
     /**
      * @brief Normalizes the vector in-place using specified normalization method
      * @param type Normalization type to apply:
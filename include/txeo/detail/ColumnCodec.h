@@ -0,0 +1,58 @@
+#ifndef TXEO_COLUMNCODEC_H
+#define TXEO_COLUMNCODEC_H
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace txeo::detail {
+
+/**
+ * @brief Transformations applied to a column before it is stored
+ */
+enum ColumnFlags : uint32_t {
+  column_delta = 1U,     ///< Integers replaced by the zigzag-encoded difference to the previous one
+  column_shuffle = 2U,   ///< Byte i of every element stored together, for each i
+  column_compressed = 4U ///< Compressed with @ref lz_compress
+};
+
+/**
+ * @brief Compresses a buffer with a byte-oriented LZ77 scheme
+ *
+ * The output is a sequence of literal runs, each followed by a back reference, with lengths and
+ * offsets stored as variable-length integers. Runs of repeated bytes, such as the high bytes of
+ * shuffled small integers, collapse into overlapping references.
+ */
+std::vector<uint8_t> lz_compress(const uint8_t *data, size_t size);
+
+/**
+ * @brief Decompresses the output of @ref lz_compress
+ *
+ * @return false if the input is corrupted or does not expand to exactly @p out_size bytes
+ */
+bool lz_decompress(const uint8_t *data, size_t size, uint8_t *out, size_t out_size);
+
+/**
+ * @brief Encodes a strided column of @p n_rows elements
+ *
+ * Integers are delta encoded and shuffled, floating-point values are shuffled. The result is
+ * compressed unless compression does not reduce its size.
+ *
+ * @param flags Receives the @ref ColumnFlags applied
+ */
+template <typename T>
+std::vector<uint8_t> encode_column(const T *data, size_t n_rows, size_t stride, uint32_t &flags);
+
+/**
+ * @brief Decodes a column encoded by @ref encode_column into a strided buffer
+ *
+ * @return false if the encoded bytes are corrupted
+ */
+template <typename T>
+bool decode_column(const uint8_t *bytes, size_t size, uint32_t flags, T *out, size_t n_rows,
+                   size_t stride);
+
+} // namespace txeo::detail
+
+#endif
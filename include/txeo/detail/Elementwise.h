@@ -0,0 +1,44 @@
+#ifndef TXEO_ELEMENTWISE_H
+#define TXEO_ELEMENTWISE_H
+#pragma once
+
+#include <cstddef>
+
+namespace txeo::detail {
+
+/**
+ * @brief Arithmetic operations supported by the elementwise kernels
+ */
+enum class ElementOp { SUM, SUBTRACT, MULTIPLY, DIVIDE };
+
+/**
+ * @brief Computes out[i] = left[i] op right[i] for i in [0, size)
+ *
+ * The loops run over raw buffers and are vectorized with runtime dispatch between AVX-512, AVX2 and
+ * portable code. The output may alias either operand, which is how the in-place variants of
+ * TensorOp are implemented. Divisors are not checked.
+ *
+ * @param op Operation to apply
+ * @param left Buffer of the left operands
+ * @param right Buffer of the right operands
+ * @param out Buffer receiving the results
+ * @param size Number of elements
+ */
+template <typename T>
+void elementwise(ElementOp op, const T *left, const T *right, T *out, size_t size);
+
+/**
+ * @brief Computes out[i] = left[i] op right for i in [0, size)
+ */
+template <typename T>
+void elementwise(ElementOp op, const T *left, T right, T *out, size_t size);
+
+/**
+ * @brief Computes out[i] = left op right[i] for i in [0, size)
+ */
+template <typename T>
+void elementwise(ElementOp op, T left, const T *right, T *out, size_t size);
+
+} // namespace txeo::detail
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef TXEO_GEMM_H
+#define TXEO_GEMM_H
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace txeo::detail {
+
+/**
+ * @brief Largest product volume (m * n * k) computed by the native kernel
+ *
+ * Below this volume the fixed cost of dispatching a TensorFlow graph dominates, so the native
+ * kernel is faster. Above it TensorFlow's MatMul wins. The value was chosen from the crossover
+ * measured by the `txeo_bench_gemm_crossover` example.
+ */
+inline constexpr size_t native_gemm_max_volume{size_t{1} << 21};
+
+/**
+ * @brief Checks whether TensorFlow provides a MatMul kernel for the type
+ */
+template <typename T>
+inline constexpr bool has_tf_matmul =
+    std::is_same_v<T, float> || std::is_same_v<T, double> || std::is_same_v<T, int> ||
+    std::is_same_v<T, long> || std::is_same_v<T, long long>;
+
+/**
+ * @brief Decides whether a product of an (m x k) by a (k x n) matrix runs natively
+ *
+ * Types without a TensorFlow MatMul kernel always run natively.
+ */
+template <typename T>
+constexpr bool use_native_gemm(size_t m, size_t n, size_t k) {
+  if constexpr (!has_tf_matmul<T>)
+    return true;
+  else
+    return m * n * k <= native_gemm_max_volume;
+}
+
+/**
+ * @brief Computes C = op(A) op(B) on row-major buffers
+ *
+ * op(A) is (m x k) and op(B) is (k x n). When a transposition flag is set the corresponding
+ * buffer holds the transposed operand, that is, A is (k x m) or B is (n x k). C is overwritten.
+ * The product is blocked for cache reuse, vectorized with runtime instruction set dispatch and
+ * split by rows across the shared thread pool when it is large enough.
+ *
+ * @param trans_a Whether A holds op(A) transposed
+ * @param trans_b Whether B holds op(B) transposed
+ * @param m Number of rows of op(A) and C
+ * @param n Number of columns of op(B) and C
+ * @param k Number of columns of op(A) and rows of op(B)
+ * @param a Buffer of A
+ * @param b Buffer of B
+ * @param c Buffer of C with m * n elements
+ */
+template <typename T>
+void gemm(bool trans_a, bool trans_b, size_t m, size_t n, size_t k, const T *a, const T *b,
+          T *c);
+
+} // namespace txeo::detail
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef MPMCQUEUE_H
+#define MPMCQUEUE_H
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace txeo::detail {
+
+/**
+ * @brief Bounded lock-free queue for any number of producers and consumers
+ *
+ * Each cell carries a sequence number telling whether it is ready to be written or read at a given
+ * position, so producers and consumers only contend on their own position counter (D. Vyukov's
+ * bounded MPMC queue).
+ *
+ * @tparam T Type of the elements, which must be default constructible
+ */
+template <typename T>
+class MpmcQueue {
+  public:
+    MpmcQueue(const MpmcQueue &) = delete;
+    MpmcQueue(MpmcQueue &&) = delete;
+    MpmcQueue &operator=(const MpmcQueue &) = delete;
+    MpmcQueue &operator=(MpmcQueue &&) = delete;
+    ~MpmcQueue() = default;
+
+    /**
+     * @param capacity Minimum number of elements held, rounded up to a power of two
+     */
+    explicit MpmcQueue(size_t capacity) {
+      size_t size{2};
+      while (size < capacity)
+        size <<= 1;
+      _cells = std::make_unique<Cell[]>(size);
+      _mask = size - 1;
+      for (size_t i{0}; i < size; ++i)
+        _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    /**
+     * @return false if the queue is full
+     */
+    bool push(const T &value) {
+      auto pos = _enqueue.load(std::memory_order_relaxed);
+      while (true) {
+        auto &cell = _cells[pos & _mask];
+        auto seq = cell.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+        if (diff == 0) {
+          if (_enqueue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+            cell.value = value;
+            cell.sequence.store(pos + 1, std::memory_order_release);
+            return true;
+          }
+        } else if (diff < 0)
+          return false;
+        else
+          pos = _enqueue.load(std::memory_order_relaxed);
+      }
+    }
+
+    /**
+     * @return false if the queue is empty
+     */
+    bool pop(T &value) {
+      auto pos = _dequeue.load(std::memory_order_relaxed);
+      while (true) {
+        auto &cell = _cells[pos & _mask];
+        auto seq = cell.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+        if (diff == 0) {
+          if (_dequeue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+            value = cell.value;
+            cell.sequence.store(pos + _mask + 1, std::memory_order_release);
+            return true;
+          }
+        } else if (diff < 0)
+          return false;
+        else
+          pos = _dequeue.load(std::memory_order_relaxed);
+      }
+    }
+
+    [[nodiscard]] size_t capacity() const { return _mask + 1; }
+
+  private:
+    struct Cell {
+        std::atomic<size_t> sequence{0};
+        T value{};
+    };
+
+    std::unique_ptr<Cell[]> _cells;
+    size_t _mask{0};
+    alignas(64) std::atomic<size_t> _enqueue{0};
+    alignas(64) std::atomic<size_t> _dequeue{0};
+};
+
+} // namespace txeo::detail
+
+#endif
@@ -4,8 +4,12 @@
 
 #include "txeo/Predictor.h"
 
+#include <mutex>
+#include <string>
 #include <tensorflow/cc/saved_model/loader.h>
 #include <tensorflow/core/public/session.h>
+#include <unordered_map>
+#include <vector>
 
 template <typename T>
 struct txeo::Predictor<T>::Impl {
@@ -16,6 +20,23 @@ struct txeo::Predictor<T>::Impl {
     Predictor<T>::TensorInfo in_name_shape_map;
     Predictor<T>::TensorInfo out_name_shape_map;
     std::filesystem::path model_path{""};
+    txeo::PredictorConfig config;
+
+    // Feeds and fetches resolved once by the session, keyed by their names
+    std::mutex callables_mutex;
+    std::unordered_map<std::string, tensorflow::Session::CallableHandle> callables;
+    tensorflow::Session::CallableHandle predict_callable{0};
+    bool use_callables{true};
+
+    tensorflow::Session::CallableHandle callable(const std::vector<std::string> &feeds,
+                                                 const std::vector<std::string> &fetches);
+    void release_callables();
+
+    // Runs the session, through a callable unless callables are disabled
+    tensorflow::Status run(const std::vector<std::string> &feeds,
+                           const std::vector<tensorflow::Tensor> &feed_tensors,
+                           const std::vector<std::string> &fetches,
+                           std::vector<tensorflow::Tensor> *outputs);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,73 @@
+#ifndef TXEO_REDUCTION_H
+#define TXEO_REDUCTION_H
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace txeo::detail {
+
+/**
+ * @brief Reductions supported by the native kernel
+ *
+ * SUM_SQUARES accumulates the squares of the elements, the Euclidean norm being its square root.
+ */
+enum class ReduceOp { SUM, PROD, MAX, MIN, SUM_SQUARES, ALL, ANY };
+
+/**
+ * @brief Largest number of input elements reduced by the native kernel
+ *
+ * Below this size the fixed cost of dispatching a TensorFlow graph dominates, so the native
+ * kernel is faster. Above it the reduction is handed to TensorFlow whenever TensorFlow has a
+ * kernel for the type. The value was chosen from the crossover measured by the
+ * `txeo_bench_reduce_crossover` example.
+ */
+inline constexpr size_t native_reduce_max_size{size_t{1} << 24};
+
+/**
+ * @brief Checks whether TensorFlow provides arithmetic reduction kernels for the type
+ */
+template <typename T>
+inline constexpr bool has_tf_reduction =
+    std::is_same_v<T, float> || std::is_same_v<T, double> || std::is_same_v<T, short> ||
+    std::is_same_v<T, int> || std::is_same_v<T, long> || std::is_same_v<T, long long>;
+
+/**
+ * @brief Decides whether a reduction of a tensor with @p size elements runs natively
+ *
+ * Types without a TensorFlow kernel for the reduction always run natively. TensorFlow only
+ * reduces boolean tensors with ALL and ANY.
+ */
+template <typename T>
+constexpr bool use_native_reduce(ReduceOp op, size_t size) {
+  if (size <= native_reduce_max_size)
+    return true;
+  if (op == ReduceOp::ALL || op == ReduceOp::ANY)
+    return !std::is_same_v<T, bool>;
+
+  return !has_tf_reduction<T>;
+}
+
+/**
+ * @brief Reduces a row-major buffer along a set of axes
+ *
+ * Axes of dimension one are dropped and runs of adjacent axes that are all kept or all reduced
+ * are folded into one, so that the innermost run is a contiguous loop. When it is reduced, each
+ * output element is a vectorized reduction of contiguous segments; when it is kept, contiguous
+ * rows are combined elementwise into a block of the output. Independent output blocks, or chunks
+ * of a full reduction, run across the shared thread pool when the tensor is large enough.
+ *
+ * @param op Reduction to apply
+ * @param in Input buffer
+ * @param dims Dimensions of the input axes
+ * @param reduced Flags of the reduced axes, one per input axis
+ * @param out Output buffer, holding the product of the kept dimensions in row-major order
+ */
+template <typename T>
+void reduce(ReduceOp op, const T *in, const std::vector<size_t> &dims,
+            const std::vector<bool> &reduced, T *out);
+
+} // namespace txeo::detail
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef TXEO_SIMD_H
+#define TXEO_SIMD_H
+#pragma once
+
+/**
+ * @brief Marks a kernel for runtime dispatch between AVX-512, AVX2 and portable code
+ *
+ * On x86-64 with GCC or Clang the compiler emits one clone of the function per instruction set and
+ * the loader binds the best one supported by the running CPU, so the inner loops are vectorized to
+ * the widest available registers without requiring special build flags. Elsewhere the macro
+ * expands to nothing and the portable version is used.
+ */
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(TXEO_NO_SIMD)
+#define TXEO_SIMD_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define TXEO_SIMD_CLONES
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TXEO_RESTRICT __restrict__
+#else
+#define TXEO_RESTRICT
+#endif
+
+#endif
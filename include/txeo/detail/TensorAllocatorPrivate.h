@@ -0,0 +1,58 @@
+#ifndef TENSOR_ALLOCATOR_PRIVATE_H
+#define TENSOR_ALLOCATOR_PRIVATE_H
+#pragma once
+
+#include "txeo/TensorAllocator.h"
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <tensorflow/core/framework/allocator.h>
+
+namespace txeo::detail {
+
+/**
+ * @brief Exposes a @ref txeo::TensorAllocator to TensorFlow as a tensorflow::Allocator
+ *
+ * TensorFlow gives buffers back through DeallocateRaw(ptr) only, so each block is prefixed by a
+ * header recording its size and alignment. The adapter counts the buffers it hands out and keeps
+ * itself alive until the last of them is given back, even if its allocator is destroyed first.
+ */
+class AllocatorAdapter : public tensorflow::Allocator {
+  public:
+    explicit AllocatorAdapter(TensorAllocator *owner) : _owner{owner} {}
+
+    std::string Name() override;
+    void *AllocateRaw(size_t alignment, size_t num_bytes) override;
+    void DeallocateRaw(void *ptr) override;
+
+    [[nodiscard]] AllocatorStats stats() const;
+    void record_reuse() { _reuses.fetch_add(1, std::memory_order_relaxed); }
+    void retire(std::function<void()> release);
+
+    /**
+     * @brief Adapter of the allocator selected by the innermost @ref txeo::AllocatorScope of this
+     * thread, or nullptr if tensors should use the TensorFlow CPU allocator
+     */
+    static tensorflow::Allocator *current();
+
+  private:
+    std::atomic<TensorAllocator *> _owner;
+    std::function<void()> _release;
+
+    // One reference per outstanding buffer plus one held by the owner
+    std::atomic<size_t> _references{1};
+
+    std::atomic<size_t> _allocations{0};
+    std::atomic<size_t> _deallocations{0};
+    std::atomic<size_t> _reuses{0};
+    std::atomic<size_t> _bytes_in_use{0};
+    std::atomic<size_t> _peak_bytes_in_use{0};
+
+    void unref();
+};
+
+} // namespace txeo::detail
+
+#endif
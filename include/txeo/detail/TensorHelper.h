@@ -10,6 +10,7 @@
 
 #include <initializer_list>
 #include <stdexcept>
+#include <string>
 #include <tensorflow/cc/client/client_session.h>
 #include <tensorflow/cc/ops/standard_ops.h>
 #include <tensorflow/core/framework/tensor.h>
@@ -42,28 +43,74 @@ class TensorHelper {
     using OpeFunc =
         std::function<tf::Output(const tf::Scope &scope, tf::Input left, tf::Input right)>;
 
+    using GraphFunc =
+        std::function<tf::Output(const tf::Scope &scope, const std::vector<tf::Output> &inputs)>;
+
     template <typename T, typename U>
     static txeo::Tensor<T> to_txeo_tensor(U &&tf_tensor);
 
     template <typename T, typename U>
     static txeo::Matrix<T> to_txeo_matrix(U &&tf_tensor);
 
+    // Makes an existing tensor share the buffer of tf_tensor, without copying its elements
+    template <typename T>
+    static void adopt_tf_tensor(txeo::Tensor<T> &tensor, tf::Tensor &&tf_tensor);
+
     template <typename T>
     static txeo::Tensor<T> reduce_tensor(const tf::Tensor &M, const std::vector<size_t> &axes,
-                                         ReduFunc3 func);
+                                         const std::string &op_name, ReduFunc3 func);
 
     template <typename T>
-    static txeo::Tensor<T> reduce_tensor(const tf::Tensor &M, ReduFunc2 func);
+    static txeo::Tensor<T> reduce_tensor(const tf::Tensor &M, const std::string &op_name,
+                                         ReduFunc2 func);
 
     template <typename T>
     static txeo::Tensor<size_t> reduce_tensor_to_indexes(const tf::Tensor &M, int64_t index,
+                                                         const std::string &op_name,
                                                          ReduFunc31 func);
 
     template <typename T>
-    static txeo::Tensor<T> reduce_tensor(const tf::Tensor &M, const int64_t &axis, ReduFunc31 func);
+    static txeo::Tensor<T> reduce_tensor(const tf::Tensor &M, const int64_t &axis,
+                                         const std::string &op_name, ReduFunc31 func);
 
     template <typename T>
-    static txeo::Tensor<T> ope_tensors(const tf::Tensor &M, const tf::Tensor &N, OpeFunc func);
+    static txeo::Tensor<T> ope_tensors(const tf::Tensor &M, const tf::Tensor &N,
+                                       const std::string &op_name, OpeFunc func);
+
+    /**
+     * @brief Runs a single-output graph fed by placeholders, reusing a previously built graph
+     * and session whenever the same operation is requested again
+     *
+     * @details Graphs are keyed by operation name, dtype and rank of each input and by the
+     * attributes baked into the graph (axes, for instance). On a cache hit only a session run is
+     * performed. Graphs are built outside the cache lock, and a full cache evicts the least
+     * recently used graph.
+     *
+     * @param op_name Name identifying the operation
+     * @param attrs Attributes that are baked into the graph as constants
+     * @param inputs Tensors fed to the placeholders, in the order received by @p func
+     * @param func Builds the operation from the placeholders
+     * @return tf::Tensor Output of the operation
+     */
+    static tf::Tensor run_graph(const std::string &op_name, const std::vector<int64_t> &attrs,
+                                const std::vector<tf::Tensor> &inputs, GraphFunc func);
+
+    /**
+     * @brief Enables or disables the reuse of graphs and sessions (enabled by default)
+     *
+     * @param enable Whether graphs are to be reused
+     */
+    static void enable_graph_cache(bool enable);
+
+    /**
+     * @brief Releases every cached graph and session
+     */
+    static void clear_graph_cache();
+
+    /**
+     * @brief Returns the number of cached graphs
+     */
+    static size_t graph_cache_size();
 };
 
 template <typename T, typename U>
@@ -78,6 +125,19 @@ txeo::Tensor<T> TensorHelper::to_txeo_tensor(U &&tf_tensor) {
   return resp;
 }
 
+template <typename T>
+void TensorHelper::adopt_tf_tensor(txeo::Tensor<T> &tensor, tf::Tensor &&tf_tensor) {
+  auto &impl = *tensor._impl;
+  if (impl.tf_tensor)
+    *impl.tf_tensor = std::move(tf_tensor);
+  else
+    impl.tf_tensor = std::make_unique<tensorflow::Tensor>(std::move(tf_tensor));
+  auto &shape = *impl.txeo_shape._impl;
+  shape.tf_shape = nullptr;
+  shape.ext_tf_shape = &impl.tf_tensor->shape();
+  shape.stride = txeo::detail::calc_stride(*shape.ext_tf_shape);
+}
+
 template <typename T, typename U>
 txeo::Matrix<T> TensorHelper::to_txeo_matrix(U &&tf_tensor) {
   txeo::Matrix<T> resp;
@@ -91,88 +151,72 @@ txeo::Matrix<T> TensorHelper::to_txeo_matrix(U &&tf_tensor) {
 
 template <typename T>
 txeo::Tensor<T> TensorHelper::reduce_tensor(const tf::Tensor &M, const std::vector<size_t> &axes,
-                                            ReduFunc3 func) {
-  tf::Scope root = tf::Scope::NewRootScope();
-
+                                            const std::string &op_name, ReduFunc3 func) {
   auto vec = txeo::detail::to_int64(axes);
-  tf::Tensor axes_tensor(tf::DT_INT64, tf::TensorShape({txeo::detail::to_int64(vec.size())}));
-  auto axes_tensor_flat = axes_tensor.flat<int64_t>();
-  for (size_t i = 0; i < vec.size(); ++i)
-    axes_tensor_flat(i) = vec[i];
-
-  auto ope = func(root, M, axes_tensor);
-
-  tf::ClientSession session(root);
-  std::vector<tf::Tensor> outputs;
-  auto status = session.Run({ope}, &outputs);
-  if (!status.ok())
-    throw std::runtime_error(status.ToString());
-  return txeo::detail::TensorHelper::to_txeo_tensor<T>(std::move(outputs[0]));
+
+  auto output = TensorHelper::run_graph(
+      op_name, vec, {M},
+      [&vec, &func](const tf::Scope &scope, const std::vector<tf::Output> &inputs) {
+        tf::Tensor axes_tensor(tf::DT_INT64,
+                               tf::TensorShape({txeo::detail::to_int64(vec.size())}));
+        auto axes_tensor_flat = axes_tensor.flat<int64_t>();
+        for (size_t i = 0; i < vec.size(); ++i)
+          axes_tensor_flat(i) = vec[i];
+        return func(scope, inputs[0], axes_tensor);
+      });
+
+  return txeo::detail::TensorHelper::to_txeo_tensor<T>(std::move(output));
 }
 
 template <typename T>
-txeo::Tensor<T> TensorHelper::reduce_tensor(const tf::Tensor &M, ReduFunc2 func) {
-  tf::Scope root = tf::Scope::NewRootScope();
-
-  auto ope = func(root, M);
-
-  tf::ClientSession session(root);
-  std::vector<tf::Tensor> outputs;
-  auto status = session.Run({ope}, &outputs);
-  if (!status.ok())
-    throw std::runtime_error(status.ToString());
-  return txeo::detail::TensorHelper::to_txeo_tensor<T>(std::move(outputs[0]));
+txeo::Tensor<T> TensorHelper::reduce_tensor(const tf::Tensor &M, const std::string &op_name,
+                                            ReduFunc2 func) {
+  auto output = TensorHelper::run_graph(
+      op_name, {}, {M}, [&func](const tf::Scope &scope, const std::vector<tf::Output> &inputs) {
+        return func(scope, inputs[0]);
+      });
+
+  return txeo::detail::TensorHelper::to_txeo_tensor<T>(std::move(output));
 }
 
 template <typename T>
 txeo::Tensor<size_t> TensorHelper::reduce_tensor_to_indexes(const tf::Tensor &M, int64_t index,
+                                                            const std::string &op_name,
                                                             ReduFunc31 func) {
-  tf::Scope root = tf::Scope::NewRootScope();
-
-  auto ope = func(root, M, index);
+  auto output = TensorHelper::run_graph(
+      op_name, {index}, {M},
+      [index, &func](const tf::Scope &scope, const std::vector<tf::Output> &inputs) {
+        return func(scope, inputs[0], index);
+      });
 
-  tf::ClientSession session(root);
-  std::vector<tf::Tensor> outputs;
-  auto status = session.Run({ope}, &outputs);
-  if (!status.ok())
-    throw std::runtime_error(status.ToString());
-
-  auto resp = txeo::detail::TensorHelper::to_txeo_tensor<size_t>(std::move(outputs[0]));
+  auto resp = txeo::detail::TensorHelper::to_txeo_tensor<size_t>(std::move(output));
 
   return resp;
 }
 
 template <typename T>
 inline txeo::Tensor<T> TensorHelper::reduce_tensor(const tf::Tensor &M, const int64_t &axis,
-                                                   ReduFunc31 func) {
-  tf::Scope root = tf::Scope::NewRootScope();
-
-  auto ope = func(root, M, axis);
+                                                   const std::string &op_name, ReduFunc31 func) {
+  auto output = TensorHelper::run_graph(
+      op_name, {axis}, {M},
+      [axis, &func](const tf::Scope &scope, const std::vector<tf::Output> &inputs) {
+        return func(scope, inputs[0], axis);
+      });
 
-  tf::ClientSession session(root);
-  std::vector<tf::Tensor> outputs;
-  auto status = session.Run({ope}, &outputs);
-  if (!status.ok())
-    throw std::runtime_error(status.ToString());
-
-  auto resp = txeo::detail::TensorHelper::to_txeo_tensor<T>(std::move(outputs[0]));
+  auto resp = txeo::detail::TensorHelper::to_txeo_tensor<T>(std::move(output));
 
   return resp;
 }
 
 template <typename T>
-txeo::Tensor<T> TensorHelper::ope_tensors(const tf::Tensor &M, const tf::Tensor &N, OpeFunc func) {
-  tf::Scope root = tf::Scope::NewRootScope();
-
-  auto ope = func(root, M, N);
-
-  tf::ClientSession session(root);
-  std::vector<tf::Tensor> outputs;
-  auto status = session.Run({ope}, &outputs);
-  if (!status.ok())
-    throw std::runtime_error(status.ToString());
-
-  auto resp = txeo::detail::TensorHelper::to_txeo_tensor<T>(std::move(outputs[0]));
+txeo::Tensor<T> TensorHelper::ope_tensors(const tf::Tensor &M, const tf::Tensor &N,
+                                          const std::string &op_name, OpeFunc func) {
+  auto output = TensorHelper::run_graph(
+      op_name, {}, {M, N}, [&func](const tf::Scope &scope, const std::vector<tf::Output> &inputs) {
+        return func(scope, inputs[0], inputs[1]);
+      });
+
+  auto resp = txeo::detail::TensorHelper::to_txeo_tensor<T>(std::move(output));
 
   return resp;
 }
@@ -0,0 +1,148 @@
+#ifndef TXEO_TEXTPARSER_H
+#define TXEO_TEXTPARSER_H
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+#include <vector>
+
+namespace txeo::detail {
+
+/**
+ * @brief Returned by @ref parse_row when a field is not a number
+ */
+inline constexpr size_t invalid_row{static_cast<size_t>(-1)};
+
+/**
+ * @brief Reads the lines of a text file through a large reusable block buffer
+ *
+ * Lines are returned as views into the buffer, without the line terminator ("\n" or "\r\n"). A
+ * view stays valid until the next call to @ref next_line.
+ */
+class LineReader {
+  public:
+    explicit LineReader(const std::filesystem::path &path, size_t block_bytes = size_t{1} << 20);
+
+    [[nodiscard]] bool is_open() const { return _file.is_open(); }
+
+    /**
+     * @brief Reads the next line
+     *
+     * @return false if the end of the file was reached
+     */
+    bool next_line(std::string_view &line);
+
+  private:
+    std::ifstream _file;
+    std::vector<char> _buffer;
+    size_t _begin{0};
+    size_t _end{0};
+    bool _eof{false};
+
+    void fill();
+};
+
+/**
+ * @brief Read-only memory mapping of a whole file
+ */
+class MappedFile {
+  public:
+    explicit MappedFile(const std::filesystem::path &path);
+    MappedFile(const MappedFile &) = delete;
+    MappedFile(MappedFile &&) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile &operator=(MappedFile &&) = delete;
+    ~MappedFile();
+
+    [[nodiscard]] bool is_open() const { return _open; }
+
+    [[nodiscard]] std::string_view text() const {
+      return {static_cast<const char *>(_data), _size};
+    }
+
+  private:
+    void *_data{nullptr};
+    size_t _size{0};
+    bool _open{false};
+};
+
+/**
+ * @brief Removes the first line from a text and returns it without its line terminator
+ *
+ * @return false if the text is empty
+ */
+bool pop_line(std::string_view &text, std::string_view &line);
+
+/**
+ * @brief Splits a text into at most @p max_parts consecutive parts made of whole lines
+ *
+ * Parts have roughly the same size and at least @p min_part_bytes bytes, except for the last one.
+ */
+std::vector<std::string_view> split_lines(std::string_view text, size_t max_parts,
+                                          size_t min_part_bytes);
+
+/**
+ * @brief Parses a numeric field, ignoring surrounding blanks
+ *
+ * @return false if the field is not entirely a number
+ */
+bool parse_number(std::string_view field, double &value);
+
+/**
+ * @brief Counts the fields of a line split by a separator
+ *
+ * As with std::getline, a separator ending the line does not start a new field.
+ */
+size_t count_fields(std::string_view line, char separator);
+
+/**
+ * @brief Calls @p func with the index and the text of each field of a line
+ *
+ * Fields are split as in @ref count_fields.
+ *
+ * @return Number of fields of the line
+ */
+template <typename F>
+size_t for_each_field(std::string_view line, char separator, F &&func) {
+  size_t n_fields{0};
+  size_t pos{0};
+  while (true) {
+    auto end = line.find(separator, pos);
+    func(n_fields++, line.substr(pos, end == std::string_view::npos ? end : end - pos));
+    if (end == std::string_view::npos || end + 1 == line.size())
+      return n_fields;
+    pos = end + 1;
+  }
+}
+
+/**
+ * @brief Parses the fields of a line into a row of fixed length
+ *
+ * Fields are split as in @ref count_fields and parsed as double before the conversion to T.
+ *
+ * @return Number of fields of the line, capped at @p n_cols + 1, or @ref invalid_row if one of the
+ * first @p n_cols fields is not a number
+ */
+template <typename T>
+size_t parse_row(std::string_view line, char separator, T *row, size_t n_cols) {
+  size_t n_fields{0};
+  size_t pos{0};
+  while (true) {
+    if (n_fields == n_cols)
+      return n_cols + 1;
+    auto end = line.find(separator, pos);
+    double value{0};
+    if (!parse_number(line.substr(pos, end == std::string_view::npos ? end : end - pos), value))
+      return invalid_row;
+    row[n_fields++] = static_cast<T>(value);
+    if (end == std::string_view::npos || end + 1 == line.size())
+      return n_fields;
+    pos = end + 1;
+  }
+}
+
+} // namespace txeo::detail
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef TXEO_TEXTWRITER_H
+#define TXEO_TEXTWRITER_H
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+
+namespace txeo::detail {
+
+/**
+ * @brief Writes a row-major matrix to a stream as delimited text
+ *
+ * Elements are formatted with std::to_chars. Floating-point elements are written in the shortest
+ * form that reads back to the same value or, if @p precision is not negative, with @p precision
+ * decimal places in fixed notation. Rows are formatted into large blocks, concurrently on the
+ * shared thread pool when the matrix is large, and every block is written with a single call.
+ * Rows are separated by a newline, with none after the last one.
+ *
+ * @param os Output stream
+ * @param data Buffer of the matrix
+ * @param n_rows Number of rows
+ * @param n_cols Number of columns
+ * @param separator Character delimiting each element in a row
+ * @param precision Number of decimal places of floating-point elements (negative means shortest)
+ */
+template <typename T>
+void write_text(std::ostream &os, const T *data, size_t n_rows, size_t n_cols, char separator,
+                int precision = -1);
+
+} // namespace txeo::detail
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef TXEO_THREADPOOL_H
+#define TXEO_THREADPOOL_H
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace txeo::detail {
+
+/**
+ * @brief Persistent pool of worker threads shared by the native compute kernels
+ *
+ * Workers are created once and reused, so splitting a loop across threads costs a queue push and
+ * a wake-up instead of a thread creation. Calls issued from inside a worker run serially, which
+ * keeps nested parallel loops from deadlocking the pool.
+ */
+class ThreadPool {
+  public:
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool(ThreadPool &&) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+    ThreadPool &operator=(ThreadPool &&) = delete;
+    ~ThreadPool();
+
+    /**
+     * @brief Returns the process wide pool, sized after the hardware concurrency
+     */
+    static ThreadPool &instance();
+
+    /**
+     * @brief Number of threads that take part in a parallel loop (workers plus the caller)
+     */
+    [[nodiscard]] size_t size() const { return _workers.size() + 1; }
+
+    /**
+     * @brief Splits [0, n) into contiguous chunks and runs them concurrently
+     *
+     * The calling thread processes the first chunk and blocks until every chunk is finished. The
+     * first exception thrown by a chunk is rethrown to the caller.
+     *
+     * @param n Number of iterations
+     * @param grain Minimum number of iterations per chunk
+     * @param func Callable receiving the half-open range [begin, end) of a chunk
+     * @param max_threads Upper bound on the number of chunks (zero means the pool size)
+     */
+    void parallel_for(size_t n, size_t grain, const std::function<void(size_t, size_t)> &func,
+                      size_t max_threads = 0);
+
+  private:
+    explicit ThreadPool(size_t num_workers);
+
+    void work();
+
+    std::vector<std::thread> _workers;
+    std::queue<std::function<void()>> _tasks;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _stop{false};
+};
+
+} // namespace txeo::detail
+
+#endif
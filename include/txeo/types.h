@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
 namespace txeo {
 
@@ -31,9 +33,95 @@ struct DeviceInfo {
     size_t memory_limit{};
 };
 
+/**
+ * @brief Session settings of a @ref txeo::Predictor
+ *
+ * Zero thread counts leave the choice to TensorFlow, which sizes its pools to the whole machine.
+ * Predictors sharing a host should bound their pools, or share one inter-op pool, so that they do
+ * not oversubscribe the cores.
+ */
+struct PredictorConfig {
+    /**
+     * @brief Threads used to parallelize a single operation (zero means one per core, or one per
+     * CPU of @ref cpu_affinity)
+     *
+     */
+    size_t intra_op_threads{0};
+
+    /**
+     * @brief Threads running independent operations concurrently (zero means one per core)
+     *
+     */
+    size_t inter_op_threads{0};
+
+    /**
+     * @brief Whether the session creates thread pools of its own instead of using the process-wide
+     * ones
+     *
+     */
+    bool use_per_session_threads{false};
+
+    /**
+     * @brief Name of a process-wide inter-op pool of @ref inter_op_threads threads; predictors
+     * naming the same pool share it (empty means no named pool)
+     *
+     */
+    std::string shared_inter_op_pool{};
+
+    /**
+     * @brief CPUs the threads created by the session should run on (empty means no restriction)
+     *
+     * This is a hint: threads inherit it from the thread loading the model, which is only possible
+     * on Linux. Pools created before, such as process-wide pools already in use, keep their CPUs.
+     */
+    std::vector<size_t> cpu_affinity{};
+
+    /**
+     * @brief Whether the graph is optimized (common subexpression elimination, function inlining)
+     *
+     */
+    bool optimize_graph{true};
+
+    /**
+     * @brief Whether constant subgraphs are folded
+     *
+     */
+    bool constant_folding{true};
+
+    /**
+     * @brief Whether XLA compilation is enabled
+     *
+     */
+    bool enable_xla{false};
+
+    /**
+     * @brief Whether GPU memory is allocated as needed instead of all at once
+     *
+     */
+    bool allow_gpu_memory_growth{true};
+
+    /**
+     * @brief Batch sizes of the synthetic inputs run after every model load (empty means no
+     * warmup; see @ref txeo::Predictor::warmup)
+     *
+     */
+    std::vector<size_t> warmup_batch_sizes{};
+
+    /**
+     * @brief Runs of each warmup input
+     *
+     */
+    size_t warmup_runs{2};
+};
+
 /**
  * @brief Normalization types to be used in normalization functions
  *
+ * Z_SCORE subtracts the mean and divides by the population standard deviation. Both are computed
+ * in double precision and then converted to the element type, so for integral types they are
+ * truncated once instead of being accumulated with integer arithmetic: the elements {0, 3} have
+ * mean 1 and deviation 1 and normalize to {-1, 2}.
+ *
  */
 enum class NormalizationType { MIN_MAX, Z_SCORE };
 
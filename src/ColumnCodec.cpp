@@ -0,0 +1,239 @@
+#include "txeo/detail/ColumnCodec.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+namespace txeo::detail {
+
+namespace {
+
+constexpr size_t min_match{4};
+constexpr size_t hash_bits{16};
+
+inline uint32_t load_u32(const uint8_t *p) {
+  uint32_t value{0};
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+inline size_t hash_of(const uint8_t *p) {
+  return (load_u32(p) * 2654435761U) >> (32 - hash_bits);
+}
+
+inline void put_varint(std::vector<uint8_t> &out, size_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+inline bool get_varint(const uint8_t *&p, const uint8_t *end, size_t &value) {
+  value = 0;
+  for (size_t shift{0}; p < end && shift < 64; shift += 7) {
+    auto byte = *p++;
+    value |= static_cast<size_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0)
+      return true;
+  }
+  return false;
+}
+
+// Byte b of element i goes to position b * n + i
+void shuffle(const uint8_t *in, uint8_t *out, size_t n, size_t width) {
+  for (size_t i{0}; i < n; ++i)
+    for (size_t b{0}; b < width; ++b)
+      out[b * n + i] = in[i * width + b];
+}
+
+void unshuffle(const uint8_t *in, uint8_t *out, size_t n, size_t width) {
+  for (size_t b{0}; b < width; ++b)
+    for (size_t i{0}; i < n; ++i)
+      out[i * width + b] = in[b * n + i];
+}
+
+template <typename U>
+void delta_encode(U *values, size_t n) {
+  using S = std::make_signed_t<U>;
+  constexpr auto shift = sizeof(U) * 8 - 1;
+  U prev{0};
+  for (size_t i{0}; i < n; ++i) {
+    U delta = values[i] - prev;
+    prev = values[i];
+    values[i] = static_cast<U>(delta << 1) ^ static_cast<U>(static_cast<S>(delta) >> shift);
+  }
+}
+
+template <typename U>
+void delta_decode(U *values, size_t n) {
+  U prev{0};
+  for (size_t i{0}; i < n; ++i) {
+    U zigzag = values[i];
+    U delta = (zigzag >> 1) ^ static_cast<U>(U{0} - (zigzag & U{1}));
+    prev += delta;
+    values[i] = prev;
+  }
+}
+
+} // namespace
+
+std::vector<uint8_t> lz_compress(const uint8_t *data, size_t size) {
+  std::vector<uint8_t> out;
+  out.reserve(size / 2 + 16);
+  std::vector<size_t> table(size_t{1} << hash_bits, 0);
+
+  size_t anchor{0};
+  size_t i{0};
+  while (size >= min_match && i <= size - min_match) {
+    auto h = hash_of(data + i);
+    auto candidate = table[h];
+    table[h] = i + 1;
+    if (candidate == 0 || load_u32(data + candidate - 1) != load_u32(data + i)) {
+      ++i;
+      continue;
+    }
+
+    auto from = candidate - 1;
+    auto length = min_match;
+    while (i + length < size && data[from + length] == data[i + length])
+      ++length;
+
+    put_varint(out, i - anchor);
+    out.insert(out.end(), data + anchor, data + i);
+    put_varint(out, length);
+    put_varint(out, i - from);
+
+    auto match_end = i + length;
+    for (++i; i < match_end && i <= size - min_match; i += (i + 16 < match_end ? 8 : 1))
+      table[hash_of(data + i)] = i + 1;
+    i = match_end;
+    anchor = i;
+  }
+
+  put_varint(out, size - anchor);
+  out.insert(out.end(), data + anchor, data + size);
+
+  return out;
+}
+
+bool lz_decompress(const uint8_t *data, size_t size, uint8_t *out, size_t out_size) {
+  const auto *p = data;
+  const auto *end = data + size;
+  size_t pos{0};
+  size_t value{0};
+  while (true) {
+    if (!get_varint(p, end, value) || value > static_cast<size_t>(end - p) ||
+        value > out_size - pos)
+      return false;
+    std::memcpy(out + pos, p, value);
+    p += value;
+    pos += value;
+    if (p == end)
+      break;
+
+    size_t length{0};
+    size_t offset{0};
+    if (!get_varint(p, end, length) || !get_varint(p, end, offset) || offset == 0 ||
+        offset > pos || length > out_size - pos)
+      return false;
+    // Byte by byte, since a reference may overlap the bytes it produces
+    for (size_t k{0}; k < length; ++k, ++pos)
+      out[pos] = out[pos - offset];
+  }
+
+  return pos == out_size;
+}
+
+template <typename T>
+std::vector<uint8_t> encode_column(const T *data, size_t n_rows, size_t stride, uint32_t &flags) {
+  flags = 0;
+  std::vector<uint8_t> raw(n_rows * sizeof(T));
+  if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+    using U = std::make_unsigned_t<T>;
+    std::vector<U> values(n_rows);
+    for (size_t i{0}; i < n_rows; ++i)
+      values[i] = static_cast<U>(data[i * stride]);
+    delta_encode(values.data(), n_rows);
+    shuffle(reinterpret_cast<const uint8_t *>(values.data()), raw.data(), n_rows, sizeof(T));
+    flags |= column_delta | column_shuffle;
+  } else {
+    std::vector<uint8_t> values(raw.size());
+    for (size_t i{0}; i < n_rows; ++i)
+      std::memcpy(values.data() + i * sizeof(T), data + i * stride, sizeof(T));
+    if constexpr (sizeof(T) > 1) {
+      shuffle(values.data(), raw.data(), n_rows, sizeof(T));
+      flags |= column_shuffle;
+    } else
+      raw = std::move(values);
+  }
+
+  auto compressed = lz_compress(raw.data(), raw.size());
+  if (compressed.size() >= raw.size())
+    return raw;
+  flags |= column_compressed;
+
+  return compressed;
+}
+
+template <typename T>
+bool decode_column(const uint8_t *bytes, size_t size, uint32_t flags, T *out, size_t n_rows,
+                   size_t stride) {
+  if (n_rows == 0)
+    return size == 0;
+
+  const auto raw_bytes = n_rows * sizeof(T);
+  std::vector<uint8_t> raw(raw_bytes);
+  if ((flags & column_compressed) != 0) {
+    if (!lz_decompress(bytes, size, raw.data(), raw_bytes))
+      return false;
+  } else {
+    if (size != raw_bytes)
+      return false;
+    std::memcpy(raw.data(), bytes, raw_bytes);
+  }
+
+  std::vector<uint8_t> values(raw_bytes);
+  if ((flags & column_shuffle) != 0)
+    unshuffle(raw.data(), values.data(), n_rows, sizeof(T));
+  else
+    values = std::move(raw);
+
+  if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+    if ((flags & column_delta) != 0) {
+      using U = std::make_unsigned_t<T>;
+      std::vector<U> deltas(n_rows);
+      std::memcpy(deltas.data(), values.data(), raw_bytes);
+      delta_decode(deltas.data(), n_rows);
+      for (size_t i{0}; i < n_rows; ++i)
+        out[i * stride] = static_cast<T>(deltas[i]);
+      return true;
+    }
+  } else if ((flags & column_delta) != 0)
+    return false;
+
+  for (size_t i{0}; i < n_rows; ++i)
+    std::memcpy(out + i * stride, values.data() + i * sizeof(T), sizeof(T));
+
+  return true;
+}
+
+template std::vector<uint8_t> encode_column(const short *, size_t, size_t, uint32_t &);
+template std::vector<uint8_t> encode_column(const int *, size_t, size_t, uint32_t &);
+template std::vector<uint8_t> encode_column(const bool *, size_t, size_t, uint32_t &);
+template std::vector<uint8_t> encode_column(const long *, size_t, size_t, uint32_t &);
+template std::vector<uint8_t> encode_column(const long long *, size_t, size_t, uint32_t &);
+template std::vector<uint8_t> encode_column(const float *, size_t, size_t, uint32_t &);
+template std::vector<uint8_t> encode_column(const double *, size_t, size_t, uint32_t &);
+template std::vector<uint8_t> encode_column(const size_t *, size_t, size_t, uint32_t &);
+
+template bool decode_column(const uint8_t *, size_t, uint32_t, short *, size_t, size_t);
+template bool decode_column(const uint8_t *, size_t, uint32_t, int *, size_t, size_t);
+template bool decode_column(const uint8_t *, size_t, uint32_t, bool *, size_t, size_t);
+template bool decode_column(const uint8_t *, size_t, uint32_t, long *, size_t, size_t);
+template bool decode_column(const uint8_t *, size_t, uint32_t, long long *, size_t, size_t);
+template bool decode_column(const uint8_t *, size_t, uint32_t, float *, size_t, size_t);
+template bool decode_column(const uint8_t *, size_t, uint32_t, double *, size_t, size_t);
+template bool decode_column(const uint8_t *, size_t, uint32_t, size_t *, size_t, size_t);
+
+} // namespace txeo::detail
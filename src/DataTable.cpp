@@ -1,7 +1,10 @@
 #include "txeo/DataTable.h"
+#include "txeo/MatrixIO.h"
 #include "txeo/TensorPart.h"
+#include "txeo/TensorView.h"
 #include "txeo/detail/utils.h"
 
+#include <numeric>
 #include <utility>
 
 namespace txeo {
@@ -32,9 +35,10 @@ DataTable<T>::DataTable(txeo::Matrix<T> &&data, std::vector<size_t> x_cols,
   auto my_data = std::move(data);
   size_t train_size = my_data.shape().axis_dim(0) - eval_size - test_size;
 
-  Matrix<T> train{my_data.slice(0, train_size)};
-  Matrix<T> eval{my_data.slice(train_size, train_size + eval_size)};
-  Matrix<T> test{my_data.slice(train_size + eval_size, train_size + eval_size + test_size)};
+  TensorView<T> all{my_data};
+  auto train = all.rows(0, train_size);
+  auto eval = all.rows(train_size, train_size + eval_size);
+  auto test = all.rows(train_size + eval_size, train_size + eval_size + test_size);
 
   _x_train = std::move(TensorPart<T>::sub_matrix_cols(train, x_cols));
   _y_train = std::move(TensorPart<T>::sub_matrix_cols(train, y_cols));
@@ -72,9 +76,10 @@ DataTable<T>::DataTable(txeo::Matrix<T> &&data, std::vector<size_t> y_cols, size
   auto my_data = std::move(data);
   size_t train_size = my_data.shape().axis_dim(0) - eval_size - test_size;
 
-  Matrix<T> train{my_data.slice(0, train_size)};
-  Matrix<T> eval{my_data.slice(train_size, train_size + eval_size)};
-  Matrix<T> test{my_data.slice(train_size + eval_size, train_size + eval_size + test_size)};
+  TensorView<T> all{my_data};
+  auto train = all.rows(0, train_size);
+  auto eval = all.rows(train_size, train_size + eval_size);
+  auto test = all.rows(train_size + eval_size, train_size + eval_size + test_size);
 
   _x_train = std::move(TensorPart<T>::sub_matrix_cols_exclude(train, y_cols));
   _y_train = std::move(TensorPart<T>::sub_matrix_cols(train, y_cols));
@@ -102,8 +107,9 @@ DataTable<T>::DataTable(txeo::Matrix<T> &&data, std::vector<size_t> x_cols,
   auto my_data = std::move(data);
   size_t train_size = my_data.shape().axis_dim(0) - eval_size;
 
-  Matrix<T> train{my_data.slice(0, train_size)};
-  Matrix<T> eval{my_data.slice(train_size, train_size + eval_size)};
+  TensorView<T> all{my_data};
+  auto train = all.rows(0, train_size);
+  auto eval = all.rows(train_size, train_size + eval_size);
 
   _x_train = std::move(TensorPart<T>::sub_matrix_cols(train, x_cols));
   _y_train = std::move(TensorPart<T>::sub_matrix_cols(train, y_cols));
@@ -128,8 +134,9 @@ DataTable<T>::DataTable(txeo::Matrix<T> &&data, std::vector<size_t> y_cols, size
   auto my_data = std::move(data);
   size_t train_size = my_data.shape().axis_dim(0) - eval_size;
 
-  Matrix<T> train{my_data.slice(0, train_size)};
-  Matrix<T> eval{my_data.slice(train_size, train_size + eval_size)};
+  TensorView<T> all{my_data};
+  auto train = all.rows(0, train_size);
+  auto eval = all.rows(train_size, train_size + eval_size);
 
   _x_train = std::move(TensorPart<T>::sub_matrix_cols_exclude(train, y_cols));
   _y_train = std::move(TensorPart<T>::sub_matrix_cols(train, y_cols));
@@ -257,6 +264,30 @@ DataTable<T> DataTable<T>::clone() const {
   return DataTable<T>{*this};
 }
 
+template <typename T>
+DataTable<T> DataTable<T>::from_columnar_file(const std::filesystem::path &path,
+                                              std::vector<size_t> x_cols,
+                                              std::vector<size_t> y_cols, size_t eval_percent,
+                                              size_t test_percent) {
+  if (x_cols.empty() || y_cols.empty())
+    throw DataTableError("Feature and label columns can not be empty.");
+
+  // The projected matrix holds the features followed by the labels
+  auto cols = x_cols;
+  cols.insert(cols.end(), y_cols.begin(), y_cols.end());
+  auto data = MatrixIO{path}.read_columnar_file<T>(cols);
+  std::vector<size_t> x_proj(x_cols.size());
+  std::vector<size_t> y_proj(y_cols.size());
+  std::iota(x_proj.begin(), x_proj.end(), 0);
+  std::iota(y_proj.begin(), y_proj.end(), x_cols.size());
+
+  if (test_percent != 0)
+    return DataTable<T>{std::move(data), x_proj, y_proj, eval_percent, test_percent};
+  if (eval_percent != 0)
+    return DataTable<T>{std::move(data), x_proj, y_proj, eval_percent};
+  return DataTable<T>{std::move(data), x_proj, y_proj};
+}
+
 template class DataTable<size_t>;
 template class DataTable<short>;
 template class DataTable<int>;
@@ -21,10 +21,13 @@ txeo::Matrix<T> DataTableNorm<T>::normalize(txeo::Matrix<T> &&x) const {
     throw txeo::DataTableNormError("Inconsistent feature matrix.");
 
   txeo::Matrix<T> resp{std::move(x)};
+  auto *data = resp.data();
+  auto rows = resp.row_size();
+  auto cols = resp.col_size();
 
-  for (size_t j{0}; j < resp.col_size(); ++j)
-    for (size_t i{0}; i < resp.row_size(); ++i)
-      resp(i, j) = _funcs[j](resp(i, j));
+  for (size_t i{0}; i < rows; ++i)
+    for (size_t j{0}; j < cols; ++j)
+      data[i * cols + j] = _funcs[j](data[i * cols + j]);
 
   return resp;
 }
@@ -0,0 +1,117 @@
+#include "txeo/detail/Elementwise.h"
+#include "txeo/detail/Simd.h"
+
+#include <cstddef>
+
+namespace txeo::detail {
+
+namespace {
+
+// Writes func(i) to every position of the output. Being inlined into each dispatched kernel, the
+// loop is vectorized for the instruction set of that kernel
+template <typename T, typename Func>
+inline void fill_with(T *out, size_t size, Func func) {
+  for (size_t i{0}; i < size; ++i)
+    out[i] = static_cast<T>(func(i));
+}
+
+// The operation is resolved once per call, outside the loops
+template <typename T>
+TXEO_SIMD_CLONES void tensor_tensor(ElementOp op, const T *left, const T *right, T *out,
+                                    size_t size) {
+  switch (op) {
+  case ElementOp::SUM:
+    fill_with(out, size, [=](size_t i) { return left[i] + right[i]; });
+    break;
+  case ElementOp::SUBTRACT:
+    fill_with(out, size, [=](size_t i) { return left[i] - right[i]; });
+    break;
+  case ElementOp::MULTIPLY:
+    fill_with(out, size, [=](size_t i) { return left[i] * right[i]; });
+    break;
+  case ElementOp::DIVIDE:
+    fill_with(out, size, [=](size_t i) { return left[i] / right[i]; });
+    break;
+  }
+}
+
+template <typename T>
+TXEO_SIMD_CLONES void tensor_scalar(ElementOp op, const T *left, T right, T *out, size_t size) {
+  switch (op) {
+  case ElementOp::SUM:
+    fill_with(out, size, [=](size_t i) { return left[i] + right; });
+    break;
+  case ElementOp::SUBTRACT:
+    fill_with(out, size, [=](size_t i) { return left[i] - right; });
+    break;
+  case ElementOp::MULTIPLY:
+    fill_with(out, size, [=](size_t i) { return left[i] * right; });
+    break;
+  case ElementOp::DIVIDE:
+    fill_with(out, size, [=](size_t i) { return left[i] / right; });
+    break;
+  }
+}
+
+template <typename T>
+TXEO_SIMD_CLONES void scalar_tensor(ElementOp op, T left, const T *right, T *out, size_t size) {
+  switch (op) {
+  case ElementOp::SUM:
+    fill_with(out, size, [=](size_t i) { return left + right[i]; });
+    break;
+  case ElementOp::SUBTRACT:
+    fill_with(out, size, [=](size_t i) { return left - right[i]; });
+    break;
+  case ElementOp::MULTIPLY:
+    fill_with(out, size, [=](size_t i) { return left * right[i]; });
+    break;
+  case ElementOp::DIVIDE:
+    fill_with(out, size, [=](size_t i) { return left / right[i]; });
+    break;
+  }
+}
+
+} // namespace
+
+template <typename T>
+void elementwise(ElementOp op, const T *left, const T *right, T *out, size_t size) {
+  tensor_tensor(op, left, right, out, size);
+}
+
+template <typename T>
+void elementwise(ElementOp op, const T *left, T right, T *out, size_t size) {
+  tensor_scalar(op, left, right, out, size);
+}
+
+template <typename T>
+void elementwise(ElementOp op, T left, const T *right, T *out, size_t size) {
+  scalar_tensor(op, left, right, out, size);
+}
+
+template void elementwise<size_t>(ElementOp, const size_t *, const size_t *, size_t *, size_t);
+template void elementwise<size_t>(ElementOp, const size_t *, size_t, size_t *, size_t);
+template void elementwise<size_t>(ElementOp, size_t, const size_t *, size_t *, size_t);
+template void elementwise<short>(ElementOp, const short *, const short *, short *, size_t);
+template void elementwise<short>(ElementOp, const short *, short, short *, size_t);
+template void elementwise<short>(ElementOp, short, const short *, short *, size_t);
+template void elementwise<int>(ElementOp, const int *, const int *, int *, size_t);
+template void elementwise<int>(ElementOp, const int *, int, int *, size_t);
+template void elementwise<int>(ElementOp, int, const int *, int *, size_t);
+template void elementwise<bool>(ElementOp, const bool *, const bool *, bool *, size_t);
+template void elementwise<bool>(ElementOp, const bool *, bool, bool *, size_t);
+template void elementwise<bool>(ElementOp, bool, const bool *, bool *, size_t);
+template void elementwise<long>(ElementOp, const long *, const long *, long *, size_t);
+template void elementwise<long>(ElementOp, const long *, long, long *, size_t);
+template void elementwise<long>(ElementOp, long, const long *, long *, size_t);
+template void elementwise<long long>(ElementOp, const long long *, const long long *,
+                                     long long *, size_t);
+template void elementwise<long long>(ElementOp, const long long *, long long, long long *, size_t);
+template void elementwise<long long>(ElementOp, long long, const long long *, long long *, size_t);
+template void elementwise<float>(ElementOp, const float *, const float *, float *, size_t);
+template void elementwise<float>(ElementOp, const float *, float, float *, size_t);
+template void elementwise<float>(ElementOp, float, const float *, float *, size_t);
+template void elementwise<double>(ElementOp, const double *, const double *, double *, size_t);
+template void elementwise<double>(ElementOp, const double *, double, double *, size_t);
+template void elementwise<double>(ElementOp, double, const double *, double *, size_t);
+
+} // namespace txeo::detail
@@ -0,0 +1,121 @@
+#include "txeo/detail/Gemm.h"
+#include "txeo/detail/Simd.h"
+#include "txeo/detail/ThreadPool.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace txeo::detail {
+
+namespace {
+
+// Panel of B (block_k x block_n) kept hot in L2 while the rows of A stream through it
+constexpr size_t block_n{256};
+constexpr size_t block_k{128};
+
+// Minimum volume (rows * n * k) worth handing to another thread
+constexpr size_t parallel_grain_volume{size_t{1} << 16};
+
+template <typename T>
+TXEO_SIMD_CLONES void gemm_panel(bool trans_a, size_t i0, size_t i1, size_t m, size_t n, size_t k,
+                                 size_t j0, size_t j1, size_t p0, size_t p1, const T *a,
+                                 const T *b, T *c) {
+  auto a_at = [&](size_t i, size_t p) { return trans_a ? a[p * m + i] : a[i * k + p]; };
+
+  size_t i{i0};
+  if constexpr (!std::is_same_v<T, bool>) {
+    // Four rows of C share every load of a row of B
+    for (; i + 4 <= i1; i += 4) {
+      T *TXEO_RESTRICT c0 = c + i * n;
+      T *TXEO_RESTRICT c1 = c0 + n;
+      T *TXEO_RESTRICT c2 = c1 + n;
+      T *TXEO_RESTRICT c3 = c2 + n;
+      for (size_t p{p0}; p < p1; ++p) {
+        const T a0 = a_at(i, p);
+        const T a1 = a_at(i + 1, p);
+        const T a2 = a_at(i + 2, p);
+        const T a3 = a_at(i + 3, p);
+        const T *TXEO_RESTRICT b_row = b + p * n;
+        for (size_t j{j0}; j < j1; ++j) {
+          const T b_pj = b_row[j];
+          c0[j] += a0 * b_pj;
+          c1[j] += a1 * b_pj;
+          c2[j] += a2 * b_pj;
+          c3[j] += a3 * b_pj;
+        }
+      }
+    }
+  }
+
+  for (; i < i1; ++i) {
+    T *TXEO_RESTRICT c_row = c + i * n;
+    for (size_t p{p0}; p < p1; ++p) {
+      const T a_ip = a_at(i, p);
+      const T *TXEO_RESTRICT b_row = b + p * n;
+      if constexpr (std::is_same_v<T, bool>) {
+        if (a_ip)
+          for (size_t j{j0}; j < j1; ++j)
+            c_row[j] = c_row[j] || b_row[j];
+      } else {
+        for (size_t j{j0}; j < j1; ++j)
+          c_row[j] += a_ip * b_row[j];
+      }
+    }
+  }
+}
+
+template <typename T>
+void gemm_rows(bool trans_a, size_t i0, size_t i1, size_t m, size_t n, size_t k, const T *a,
+               const T *b, T *c) {
+  std::fill(c + i0 * n, c + i1 * n, T{0});
+  for (size_t j0{0}; j0 < n; j0 += block_n) {
+    auto j1 = std::min(j0 + block_n, n);
+    for (size_t p0{0}; p0 < k; p0 += block_k) {
+      auto p1 = std::min(p0 + block_k, k);
+      gemm_panel(trans_a, i0, i1, m, n, k, j0, j1, p0, p1, a, b, c);
+    }
+  }
+}
+
+} // namespace
+
+template <typename T>
+void gemm(bool trans_a, bool trans_b, size_t m, size_t n, size_t k, const T *a, const T *b,
+          T *c) {
+  if (m == 0 || n == 0)
+    return;
+
+  // A transposed B is packed once so that the inner loop always walks contiguous rows of B
+  std::unique_ptr<T[]> packed{nullptr};
+  if (trans_b) {
+    packed = std::make_unique<T[]>(k * n);
+    for (size_t j{0}; j < n; ++j)
+      for (size_t p{0}; p < k; ++p)
+        packed[p * n + j] = b[j * k + p];
+    b = packed.get();
+  }
+
+  auto row_volume = std::max<size_t>(n * k, 1);
+  auto grain = std::max<size_t>(parallel_grain_volume / row_volume, 1);
+  ThreadPool::instance().parallel_for(m, grain, [&](size_t begin, size_t end) {
+    gemm_rows(trans_a, begin, end, m, n, k, a, b, c);
+  });
+}
+
+template void gemm<size_t>(bool, bool, size_t, size_t, size_t, const size_t *, const size_t *,
+                           size_t *);
+template void gemm<short>(bool, bool, size_t, size_t, size_t, const short *, const short *,
+                          short *);
+template void gemm<int>(bool, bool, size_t, size_t, size_t, const int *, const int *, int *);
+template void gemm<bool>(bool, bool, size_t, size_t, size_t, const bool *, const bool *, bool *);
+template void gemm<long>(bool, bool, size_t, size_t, size_t, const long *, const long *, long *);
+template void gemm<long long>(bool, bool, size_t, size_t, size_t, const long long *,
+                              const long long *, long long *);
+template void gemm<float>(bool, bool, size_t, size_t, size_t, const float *, const float *,
+                          float *);
+template void gemm<double>(bool, bool, size_t, size_t, size_t, const double *, const double *,
+                           double *);
+
+} // namespace txeo::detail
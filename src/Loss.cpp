@@ -1,6 +1,7 @@
 #include "txeo/Loss.h"
 #include "txeo/Tensor.h"
 #include "txeo/TensorShape.h"
+#include "txeo/TensorView.h"
 
 #include <cmath>
 #include <cstdlib>
@@ -11,16 +12,16 @@ template <typename T>
 void Loss<T>::set_loss(LossFunc func) {
   switch (func) {
   case LossFunc::MSE:
-    _loss_func = [this](const Tensor<T> &pred) -> T { return this->mse(pred); };
+    _loss_func = [this](const TensorView<T> &pred) -> T { return this->mse(pred); };
     break;
   case LossFunc::MAE:
-    _loss_func = [this](const Tensor<T> &pred) -> T { return this->mae(pred); };
+    _loss_func = [this](const TensorView<T> &pred) -> T { return this->mae(pred); };
     break;
   case LossFunc::MSLE:
-    _loss_func = [this](const Tensor<T> &pred) -> T { return this->msle(pred); };
+    _loss_func = [this](const TensorView<T> &pred) -> T { return this->msle(pred); };
     break;
   case LossFunc::LCHE:
-    _loss_func = [this](const Tensor<T> &pred) -> T { return this->lche(pred); };
+    _loss_func = [this](const TensorView<T> &pred) -> T { return this->lche(pred); };
     break;
   }
 }
@@ -34,7 +35,7 @@ Loss<T>::Loss(Tensor<T> &&valid, LossFunc func) : _label{std::move(valid)} {
 }
 
 template <typename T>
-void Loss<T>::verify_parameter(const Tensor<T> &pred) const {
+void Loss<T>::verify_parameter(const TensorView<T> &pred) const {
   if (pred.dim() == 0)
     throw LossError("Tensor has dimension zero.");
   if (pred.shape() != _label.shape())
@@ -42,87 +43,83 @@ void Loss<T>::verify_parameter(const Tensor<T> &pred) const {
 }
 
 template <typename T>
-T Loss<T>::mean_squared_error(const Tensor<T> &pred) const {
+T Loss<T>::mean_squared_error(const TensorView<T> &pred) const {
   this->verify_parameter(pred);
 
   T resp = 0;
-  auto pred_flat = pred.data();
   auto valid_flat = _label.data();
 
-  for (size_t i{0}; i < pred.dim(); ++i) {
-    auto aux = pred_flat[i] - valid_flat[i];
+  pred.for_each([&resp, valid_flat](size_t i, const T &value) {
+    auto aux = value - valid_flat[i];
     resp += aux * aux;
-  }
+  });
 
   return resp / pred.dim();
 }
 
 template <typename T>
-T Loss<T>::mean_absolute_error(const Tensor<T> &pred) const {
+T Loss<T>::mean_absolute_error(const TensorView<T> &pred) const {
   this->verify_parameter(pred);
 
   T resp = 0;
-  auto pred_flat = pred.data();
   auto valid_flat = _label.data();
 
-  for (size_t i{0}; i < pred.dim(); ++i)
-    resp += std::abs(pred_flat[i] - valid_flat[i]);
+  pred.for_each([&resp, valid_flat](size_t i, const T &value) {
+    resp += std::abs(value - valid_flat[i]);
+  });
 
   return resp / pred.dim();
 }
 
 template <>
-size_t Loss<size_t>::mean_absolute_error(const Tensor<size_t> &pred) const {
+size_t Loss<size_t>::mean_absolute_error(const TensorView<size_t> &pred) const {
   this->verify_parameter(pred);
 
   size_t resp = 0;
-  auto pred_flat = pred.data();
   auto valid_flat = _label.data();
 
-  for (size_t i{0}; i < pred.dim(); ++i) {
-    resp +=
-        pred_flat[i] > valid_flat[i] ? pred_flat[i] - valid_flat[i] : valid_flat[i] - pred_flat[i];
-  }
+  pred.for_each([&resp, valid_flat](size_t i, const size_t &value) {
+    resp += value > valid_flat[i] ? value - valid_flat[i] : valid_flat[i] - value;
+  });
 
   return resp / pred.shape().axis_dim(0);
 }
 
 template <typename T>
-T Loss<T>::mean_squared_logarithmic_error(const Tensor<T> &pred) const {
+T Loss<T>::mean_squared_logarithmic_error(const TensorView<T> &pred) const {
   this->verify_parameter(pred);
 
   T resp = 0;
-  auto pred_flat = pred.data();
   auto valid_flat = _label.data();
 
-  for (size_t i{0}; i < pred.dim(); ++i) {
-    if (pred_flat[i] < 0 || valid_flat[i] < 0)
+  pred.for_each([&resp, valid_flat](size_t i, const T &value) {
+    if (value < 0 || valid_flat[i] < 0)
       throw LossError("A tensor element is negative.");
 
-    auto aux = std::log1p(pred_flat[i]) - std::log1p(valid_flat[i]);
+    auto aux = std::log1p(value) - std::log1p(valid_flat[i]);
     resp += aux * aux;
-  }
+  });
 
   return resp / pred.shape().axis_dim(0);
 }
 
 template <typename T>
-T Loss<T>::log_cosh_error(const Tensor<T> &pred) const {
+T Loss<T>::log_cosh_error(const TensorView<T> &pred) const {
 
   this->verify_parameter(pred);
 
   T resp = 0;
-  auto pred_flat = pred.data();
   auto valid_flat = _label.data();
 
-  for (size_t i{0}; i < pred.dim(); ++i)
-    resp += std::log(std::cosh(pred_flat[i] - valid_flat[i]));
+  pred.for_each([&resp, valid_flat](size_t i, const T &value) {
+    resp += std::log(std::cosh(value - valid_flat[i]));
+  });
 
   return resp / pred.shape().axis_dim(0);
 }
 
 template <typename T>
-T Loss<T>::get_loss(const Tensor<T> &pred) const {
+T Loss<T>::get_loss(const TensorView<T> &pred) const {
   return _loss_func(pred);
 }
 
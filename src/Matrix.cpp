@@ -18,7 +18,7 @@ Matrix<T>::Matrix() {
 
 template <typename T>
 Matrix<T>::Matrix(Tensor<T> &&tensor) : Tensor<T>(std::move(tensor)) {
-  if (tensor.order() != 2)
+  if (this->order() != 2)
     throw MatrixError("Tensor does not have order two.");
 }
 
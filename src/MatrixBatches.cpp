@@ -0,0 +1,216 @@
+#include "txeo/MatrixBatches.h"
+#include "txeo/MatrixIO.h"
+#include "txeo/detail/TextParser.h"
+
+#include <algorithm>
+#include <array>
+#include <future>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace txeo {
+
+template <typename T>
+struct MatrixBatches<T>::Impl {
+    std::filesystem::path path;
+    char separator{','};
+    size_t batch_rows{0};
+    bool has_header{false};
+    bool prefetch{false};
+
+    std::optional<detail::LineReader> reader;
+    size_t line_number{0};
+    size_t n_cols{0};
+
+    // The batch being processed and, with prefetching, the one being parsed
+    std::array<Matrix<T>, 2> buffers;
+    size_t filling{0};
+    std::future<size_t> pending;
+    Matrix<T> last;
+    const Matrix<T> *batch{nullptr};
+    bool exhausted{false};
+
+    void open();
+    size_t fill(Matrix<T> &buffer);
+    void wait();
+};
+
+template <typename T>
+void MatrixBatches<T>::Impl::open() {
+  std::string_view line;
+  auto start = [&]() {
+    reader.emplace(path);
+    if (!reader->is_open())
+      throw MatrixIOError("Could not open file!");
+    if (has_header && reader->next_line(line) && !line.empty() && n_cols == 0)
+      n_cols = detail::count_fields(line, separator);
+  };
+
+  // The number of columns is settled here, before any batch is parsed in the background. Without
+  // a header it comes from the first non-empty line, and the file is read again from the start
+  start();
+  if (n_cols == 0) {
+    while (reader->next_line(line))
+      if (!line.empty()) {
+        n_cols = detail::count_fields(line, separator);
+        break;
+      }
+    start();
+  }
+  line_number = 0;
+  batch = nullptr;
+  exhausted = false;
+}
+
+template <typename T>
+size_t MatrixBatches<T>::Impl::fill(Matrix<T> &buffer) {
+  std::string_view line;
+  size_t n_rows{0};
+  T *row{nullptr};
+  while (n_rows < batch_rows && reader->next_line(line)) {
+    ++line_number;
+    if (line.empty())
+      continue;
+    if (row == nullptr) {
+      if (buffer.row_size() != batch_rows || buffer.col_size() != n_cols)
+        buffer = Matrix<T>(batch_rows, n_cols);
+      row = buffer.data();
+    }
+    auto cols = detail::parse_row(line, separator, row, n_cols);
+    if (cols == detail::invalid_row)
+      throw MatrixIOError("Invalid element at line " + std::to_string(line_number));
+    if (cols != n_cols)
+      throw MatrixIOError("Inconsistent number of columns!");
+    row += n_cols;
+    ++n_rows;
+  }
+
+  return n_rows;
+}
+
+template <typename T>
+void MatrixBatches<T>::Impl::wait() {
+  // A batch parsed in the background is dropped, along with any error it raised
+  if (pending.valid()) {
+    pending.wait();
+    pending = {};
+  }
+}
+
+template <typename T>
+MatrixBatches<T>::MatrixBatches(const std::filesystem::path &path, char separator,
+                                size_t batch_rows, bool has_header, bool prefetch)
+    : _impl{std::make_unique<Impl>()} {
+  if (batch_rows == 0)
+    throw MatrixIOError("Batch size must be positive!");
+  _impl->path = path;
+  _impl->separator = separator;
+  _impl->batch_rows = batch_rows;
+  _impl->has_header = has_header;
+  _impl->prefetch = prefetch;
+  _impl->open();
+}
+
+template <typename T>
+MatrixBatches<T>::MatrixBatches(MatrixBatches &&batches) noexcept = default;
+
+template <typename T>
+MatrixBatches<T> &MatrixBatches<T>::operator=(MatrixBatches &&batches) noexcept {
+  if (this != &batches) {
+    if (_impl)
+      _impl->wait();
+    _impl = std::move(batches._impl);
+  }
+  return *this;
+}
+
+template <typename T>
+MatrixBatches<T>::~MatrixBatches() {
+  if (_impl)
+    _impl->wait();
+}
+
+template <typename T>
+typename MatrixBatches<T>::Iterator MatrixBatches<T>::begin() {
+  this->rewind();
+  return Iterator{this->next() ? this : nullptr};
+}
+
+template <typename T>
+bool MatrixBatches<T>::next() {
+  auto &impl = *_impl;
+  if (impl.exhausted)
+    return false;
+
+  size_t n_rows{0};
+  auto index = impl.filling;
+  if (!impl.prefetch)
+    n_rows = impl.fill(impl.buffers[index]);
+  else {
+    if (!impl.pending.valid())
+      impl.pending = std::async(std::launch::async,
+                                [&impl, index]() { return impl.fill(impl.buffers[index]); });
+    n_rows = impl.pending.get();
+    if (n_rows == impl.batch_rows) {
+      impl.filling = 1 - index;
+      impl.pending = std::async(std::launch::async, [&impl, next = impl.filling]() {
+        return impl.fill(impl.buffers[next]);
+      });
+    }
+  }
+
+  if (n_rows < impl.batch_rows)
+    impl.exhausted = true;
+  if (n_rows == 0) {
+    impl.batch = nullptr;
+    return false;
+  }
+
+  if (n_rows == impl.batch_rows)
+    impl.batch = &impl.buffers[index];
+  else {
+    impl.last = Matrix<T>(n_rows, impl.n_cols);
+    std::copy_n(std::as_const(impl.buffers[index]).data(), n_rows * impl.n_cols,
+                impl.last.data());
+    impl.batch = &impl.last;
+  }
+
+  return true;
+}
+
+template <typename T>
+void MatrixBatches<T>::rewind() {
+  _impl->wait();
+  _impl->filling = 0;
+  _impl->open();
+}
+
+template <typename T>
+const Matrix<T> &MatrixBatches<T>::batch() const {
+  if (_impl->batch == nullptr)
+    throw MatrixIOError("No batch was read!");
+  return *_impl->batch;
+}
+
+template <typename T>
+size_t MatrixBatches<T>::batch_rows() const {
+  return _impl->batch_rows;
+}
+
+template <typename T>
+size_t MatrixBatches<T>::col_size() const {
+  return _impl->n_cols;
+}
+
+template class MatrixBatches<short>;
+template class MatrixBatches<int>;
+template class MatrixBatches<bool>;
+template class MatrixBatches<long>;
+template class MatrixBatches<long long>;
+template class MatrixBatches<float>;
+template class MatrixBatches<double>;
+template class MatrixBatches<size_t>;
+
+} // namespace txeo
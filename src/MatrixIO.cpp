@@ -1,72 +1,182 @@
 #include "txeo/MatrixIO.h"
+#include "txeo/detail/ColumnCodec.h"
+#include "txeo/detail/TextParser.h"
+#include "txeo/detail/TextWriter.h"
+#include "txeo/detail/ThreadPool.h"
 #include "txeo/detail/utils.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <fstream>
 #include <iterator>
+#include <numeric>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace txeo {
 
+namespace {
+
+// Smallest byte range worth parsing on a thread of its own
+constexpr size_t min_range_bytes{size_t{1} << 16};
+
+constexpr std::array<char, 8> columnar_magic{'T', 'X', 'E', 'O', 'C', 'O', 'L', 'S'};
+constexpr uint32_t columnar_version{1};
+constexpr uint32_t columnar_byte_order{0x01020304};
+
+// Fixed part of a columnar file, followed by one ColumnEntry per column and the column blocks.
+// Fields are stored in the byte order of the writer, recorded in byte_order.
+struct ColumnarHeader {
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t dtype;
+    uint32_t element_size;
+    uint64_t n_rows;
+    uint64_t n_cols;
+};
+
+struct ColumnEntry {
+    uint64_t offset;
+    uint64_t size;
+    uint32_t flags;
+    uint32_t reserved;
+};
+
+struct ColumnarLayout {
+    ColumnarHeader header;
+    std::vector<ColumnEntry> entries;
+};
+
+ColumnarLayout read_columnar_layout(std::istream &rf, size_t file_size) {
+  ColumnarLayout resp{};
+  auto &header = resp.header;
+  if (!rf.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+      header.magic != columnar_magic)
+    throw MatrixIOError("Not a columnar file!");
+  if (header.version != columnar_version)
+    throw MatrixIOError("Unsupported columnar file version!");
+  if (header.byte_order != columnar_byte_order)
+    throw MatrixIOError("Columnar file written with a different byte order!");
+  if (header.n_cols > (file_size - sizeof(header)) / sizeof(ColumnEntry))
+    throw MatrixIOError("Truncated columnar file!");
+
+  resp.entries.resize(header.n_cols);
+  if (!rf.read(reinterpret_cast<char *>(resp.entries.data()),
+               static_cast<std::streamsize>(header.n_cols * sizeof(ColumnEntry))))
+    throw MatrixIOError("Truncated columnar file!");
+  for (const auto &entry : resp.entries)
+    if (entry.offset > file_size || entry.size > file_size - entry.offset)
+      throw MatrixIOError("Truncated columnar file!");
+
+  return resp;
+}
+
+} // namespace
+
 template <typename T>
 Matrix<T> MatrixIO::read_text_file(bool has_header) const {
-  std::string line;
-  std::string word;
-  size_t n_rows{0};
-  size_t n_cols{0};
-  size_t aux{0};
+  return this->read_text_file<T>(has_header, 1);
+}
 
-  std::ifstream rf{_path};
-  if (rf.is_open()) {
-    _logger->info("Reading text file...");
-    while (std::getline(rf, line)) {
-      if (line.empty())
-        continue;
+template <typename T>
+Matrix<T> MatrixIO::read_text_file(bool has_header, size_t num_threads) const {
+  detail::MappedFile file{_path};
+  if (!file.is_open())
+    throw MatrixIOError("Could not open file!");
+  _logger->info("Reading text file...");
 
-      std::stringstream line_stream{line};
-      while (std::getline(line_stream, word, _separator))
-        ++aux;
-      if (n_cols != 0 && aux != n_cols) {
-        rf.close();
-        throw MatrixIOError("Inconsistent number of columns!");
-      }
-      n_cols = aux;
-      aux = 0;
-      ++n_rows;
-    }
-    if (n_rows == 0) {
-      rf.close();
-      throw MatrixIOError("File can not be empty!");
+  auto text = file.text();
+  std::string_view line;
+  size_t n_cols{0};
+  if (has_header && detail::pop_line(text, line) && !line.empty())
+    n_cols = detail::count_fields(line, _separator);
+
+  auto &pool = detail::ThreadPool::instance();
+  auto max_ranges = num_threads == 0 ? pool.size() : std::min(num_threads, pool.size());
+  auto ranges = detail::split_lines(text, max_ranges, min_range_bytes);
+
+  struct RangeInfo {
+      size_t n_lines{0};
+      size_t n_rows{0};
+      size_t n_cols{0};
+      std::string error;
+  };
+  std::vector<RangeInfo> infos(ranges.size());
+  auto for_each_range = [&](auto &&func) {
+    pool.parallel_for(
+        ranges.size(), 1,
+        [&](size_t begin, size_t end) {
+          for (auto r{begin}; r < end; ++r)
+            func(r);
+        },
+        ranges.size());
+  };
+
+  for_each_range([&](size_t r) {
+    auto range = ranges[r];
+    auto &info = infos[r];
+    std::string_view aux;
+    while (detail::pop_line(range, aux)) {
+      ++info.n_lines;
+      if (aux.empty())
+        continue;
+      if (info.n_rows++ == 0)
+        info.n_cols = detail::count_fields(aux, _separator);
     }
-    if (has_header)
-      --n_rows;
-  } else
-    throw MatrixIOError("Could not open file!");
+  });
+
+  // Prefix sums place every range at its first row and give it its first line number
+  std::vector<size_t> first_rows(ranges.size());
+  std::vector<size_t> first_lines(ranges.size());
+  size_t n_rows{0};
+  size_t n_lines{0};
+  for (size_t r{0}; r < ranges.size(); ++r) {
+    if (n_cols == 0)
+      n_cols = infos[r].n_cols;
+    first_rows[r] = n_rows;
+    first_lines[r] = n_lines;
+    n_rows += infos[r].n_rows;
+    n_lines += infos[r].n_lines;
+  }
+  if (n_cols == 0)
+    throw MatrixIOError("File can not be empty!");
 
   Matrix<T> resp{n_rows, n_cols};
-  rf.clear();
-  rf.seekg(0);
-  auto resp_ite = std::begin(resp);
-  if (has_header)
-    std::getline(rf, line);
-  size_t line_number{0};
-  while (std::getline(rf, line)) {
-    ++line_number;
-    if (line.empty())
-      continue;
-    std::stringstream line_stream{line};
-    while (std::getline(line_stream, word, _separator)) {
-      try {
-        *resp_ite = static_cast<T>(std::stod(word));
-      } catch (...) {
-        rf.close();
-        throw MatrixIOError("Invalid element at line " + std::to_string(line_number));
+  auto *data = resp.data();
+  for_each_range([&](size_t r) {
+    auto range = ranges[r];
+    auto *row = data + first_rows[r] * n_cols;
+    auto line_number = first_lines[r];
+    std::string_view aux;
+    while (detail::pop_line(range, aux)) {
+      ++line_number;
+      if (aux.empty())
+        continue;
+      auto cols = detail::parse_row(aux, _separator, row, n_cols);
+      if (cols == detail::invalid_row) {
+        infos[r].error = "Invalid element at line " + std::to_string(line_number);
+        return;
       }
-      ++resp_ite;
+      if (cols != n_cols) {
+        infos[r].error = "Inconsistent number of columns!";
+        return;
+      }
+      row += n_cols;
     }
-  }
-  rf.close();
+  });
+
+  // Ranges follow the file order, so the first error found is the one a sequential read reports
+  for (auto &info : infos)
+    if (!info.error.empty())
+      throw MatrixIOError(info.error);
+
   return resp;
 }
 
@@ -80,19 +190,7 @@ void MatrixIO::write_text_file(const Matrix<T> &tensor) const {
     _logger->info("Writing text file...");
     size_t n_rows = detail::to_size_t(tensor.shape().axis_dim(0));
     size_t n_cols = detail::to_size_t(tensor.shape().axis_dim(1));
-    auto iterator = std::cbegin(tensor);
-    size_t aux_r{0};
-    while (aux_r < n_rows) {
-      size_t aux_c{0};
-      while (aux_c < n_cols) {
-        wf << std::to_string(*iterator);
-        ++iterator;
-        if (++aux_c < n_cols)
-          wf << _separator;
-      }
-      if (++aux_r < n_rows)
-        wf << "\n";
-    }
+    detail::write_text(wf, tensor.data(), n_rows, n_cols, _separator);
     wf.close();
   } else
     throw MatrixIOError("Could not open file!");
@@ -103,7 +201,6 @@ template <typename T>
 void MatrixIO::write_text_file(const Matrix<T> &tensor, size_t precision) const {
   if (precision <= 1)
     throw MatrixIOError("Precision must be greater than 1!");
-  auto prec = precision - 1;
   if (tensor.order() != 2)
     throw MatrixIOError("Tensor is not a matrix!");
   std::ofstream wf{_path, std::ios::out};
@@ -111,120 +208,275 @@ void MatrixIO::write_text_file(const Matrix<T> &tensor, size_t precision) const
     _logger->info("Writing text file...");
     size_t n_rows = detail::to_size_t(tensor.shape().axis_dim(0));
     size_t n_cols = detail::to_size_t(tensor.shape().axis_dim(1));
-    auto iterator = std::cbegin(tensor);
-    size_t aux_r{0};
-    while (aux_r < n_rows) {
-      size_t aux_c{0};
-      while (aux_c < n_cols) {
-        wf << detail::format(*iterator, prec);
-        ++iterator;
-        if (++aux_c < n_cols)
-          wf << _separator;
-      }
-      if (++aux_r < n_rows)
-        wf << "\n";
-    }
+    detail::write_text(wf, tensor.data(), n_rows, n_cols, _separator, detail::to_int(precision));
     wf.close();
   } else
     throw MatrixIOError("Could not open file!");
 }
 
-std::map<size_t, std::unordered_set<std::string>>
-MatrixIO::build_lookups_map(const std::filesystem::path &source_path, char separator,
-                            bool has_header) {
-  std::ifstream rf{source_path};
+template <typename T>
+void MatrixIO::write_columnar_file(const Matrix<T> &matrix) const {
+  if (matrix.order() != 2)
+    throw MatrixIOError("Tensor is not a matrix!");
+  std::ofstream wf{_path, std::ios::out | std::ios::binary};
+  if (!wf.is_open())
+    throw MatrixIOError("Could not open file!");
+  _logger->info("Writing columnar file...");
+
+  auto n_rows = matrix.row_size();
+  auto n_cols = matrix.col_size();
+  std::vector<std::vector<uint8_t>> blocks(n_cols);
+  std::vector<ColumnEntry> entries(n_cols);
+  const auto *data = matrix.data();
+  detail::ThreadPool::instance().parallel_for(n_cols, 1, [&](size_t begin, size_t end) {
+    for (size_t j{begin}; j < end; ++j)
+      blocks[j] = detail::encode_column(data + j, n_rows, n_cols, entries[j].flags);
+  });
+
+  ColumnarHeader header{};
+  header.magic = columnar_magic;
+  header.version = columnar_version;
+  header.byte_order = columnar_byte_order;
+  header.dtype = static_cast<uint32_t>(detail::get_tf_dtype<T>());
+  header.element_size = sizeof(T);
+  header.n_rows = n_rows;
+  header.n_cols = n_cols;
+
+  uint64_t offset = sizeof(header) + n_cols * sizeof(ColumnEntry);
+  for (size_t j{0}; j < n_cols; ++j) {
+    entries[j].offset = offset;
+    entries[j].size = blocks[j].size();
+    offset += blocks[j].size();
+  }
+
+  wf.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  wf.write(reinterpret_cast<const char *>(entries.data()),
+           static_cast<std::streamsize>(n_cols * sizeof(ColumnEntry)));
+  for (const auto &block : blocks)
+    wf.write(reinterpret_cast<const char *>(block.data()),
+             static_cast<std::streamsize>(block.size()));
+  if (!wf)
+    throw MatrixIOError("Could not write columnar file!");
+}
+
+template <typename T>
+Matrix<T> MatrixIO::read_columnar_file() const {
+  auto [n_rows, n_cols] = this->columnar_file_shape();
+  std::vector<size_t> cols(n_cols);
+  std::iota(cols.begin(), cols.end(), 0);
+
+  return this->read_columnar_file<T>(cols);
+}
 
+template <typename T>
+Matrix<T> MatrixIO::read_columnar_file(const std::vector<size_t> &cols) const {
+  if (cols.empty())
+    throw MatrixIOError("No columns were selected!");
+  std::ifstream rf{_path, std::ios::in | std::ios::binary};
   if (!rf.is_open())
-    throw MatrixIOError("Could not open file to read!");
+    throw MatrixIOError("Could not open file!");
+  _logger->info("Reading columnar file...");
+
+  auto layout = read_columnar_layout(rf, std::filesystem::file_size(_path));
+  const auto &header = layout.header;
+  if (header.dtype != static_cast<uint32_t>(detail::get_tf_dtype<T>()) ||
+      header.element_size != sizeof(T))
+    throw MatrixIOError("Columnar file holds a different element type!");
+  for (auto col : cols)
+    if (col >= header.n_cols)
+      throw MatrixIOError("Column out of range!");
+
+  // Blocks are read in file order, so the reads only move forward
+  std::vector<size_t> order(cols.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::ranges::sort(order, {}, [&](size_t k) { return layout.entries[cols[k]].offset; });
+  std::vector<std::vector<uint8_t>> blocks(cols.size());
+  for (auto k : order) {
+    const auto &entry = layout.entries[cols[k]];
+    blocks[k].resize(entry.size);
+    rf.seekg(static_cast<std::streamoff>(entry.offset));
+    if (!rf.read(reinterpret_cast<char *>(blocks[k].data()),
+                 static_cast<std::streamsize>(entry.size)))
+      throw MatrixIOError("Truncated columnar file!");
+  }
 
-  std::string line;
-  std::string word;
-  size_t n_cols{0};
-  size_t col{0};
-  bool first_line{true};
+  auto n_rows = static_cast<size_t>(header.n_rows);
+  Matrix<T> resp(n_rows, cols.size());
+  auto *data = resp.data();
+  detail::ThreadPool::instance().parallel_for(cols.size(), 1, [&](size_t begin, size_t end) {
+    for (size_t k{begin}; k < end; ++k)
+      if (!detail::decode_column(blocks[k].data(), blocks[k].size(),
+                                 layout.entries[cols[k]].flags, data + k, n_rows, cols.size()))
+        throw MatrixIOError("Corrupted column " + std::to_string(cols[k]) + "!");
+  });
+
+  return resp;
+}
 
-  std::map<size_t, std::unordered_set<std::string>> resp;
+std::pair<size_t, size_t> MatrixIO::columnar_file_shape() const {
+  std::ifstream rf{_path, std::ios::in | std::ios::binary};
+  if (!rf.is_open())
+    throw MatrixIOError("Could not open file!");
+  auto layout = read_columnar_layout(rf, std::filesystem::file_size(_path));
 
+  return {layout.header.n_rows, layout.header.n_cols};
+}
+
+namespace {
+
+// Bytes of source text encoded per task; a wave of tasks is written before the next one starts
+constexpr size_t one_hot_chunk_bytes{size_t{1} << 22};
+
+// Columns of a one-hot encoding, shared by the text and the matrix encoders
+struct OneHotLayout {
+    std::vector<std::string_view> ranges;
+    std::vector<size_t> first_rows;
+    size_t n_rows{0};
+    size_t n_cols{0};
+    size_t n_encoded_cols{0};
+    std::vector<std::string_view> names;
+
+    // Sorted categories of each column (empty for numeric columns) and their indexes
+    std::vector<std::vector<std::string_view>> categories;
+    std::vector<std::unordered_map<std::string_view, size_t>> ids;
+};
+
+// Collects the categories of every column in one parallel pass. The views refer to the text.
+// Fields spelling NaN or infinity are categories, as such markers usually stand for missing
+// values in text columns
+bool is_numeric_field(std::string_view field) {
+  double value{0};
+  return detail::parse_number(field, value) && std::isfinite(value);
+}
+
+OneHotLayout build_one_hot_layout(std::string_view text, char separator, bool has_header) {
+  OneHotLayout resp;
+  std::string_view header;
   if (has_header)
-    std::getline(rf, line);
-  while (std::getline(rf, line)) {
-    if (line.empty())
-      continue;
-    if (std::count(line.begin(), line.end(), separator) == 0) {
-      rf.close();
-      throw MatrixIOError("Separator not found!");
-    };
-    std::stringstream line_stream{line};
-    while (std::getline(line_stream, word, separator)) {
-      if (!detail::is_numeric(word)) {
-        auto item = resp.find(col);
-        if (item != std::end(resp)) {
-          auto &lookups = item->second;
-          auto item_lookup = lookups.find(word);
-          if (item_lookup == std::end(lookups)) {
-            lookups.emplace(word);
-          }
-        } else {
-          if (!first_line) {
-            rf.close();
-            throw MatrixIOError("Different types in the same column!");
-          }
-          std::unordered_set<std::string> lookup;
-          lookup.emplace(word);
-          resp.emplace(col, lookup);
+    detail::pop_line(text, header);
+
+  auto &pool = detail::ThreadPool::instance();
+  auto max_ranges = std::max(text.size() / one_hot_chunk_bytes + 1, pool.size());
+  resp.ranges = detail::split_lines(text, max_ranges, min_range_bytes);
+
+  struct RangeDictionary {
+      size_t n_rows{0};
+      size_t n_cols{0};
+      std::vector<std::unordered_set<std::string_view>> values;
+      std::vector<char> has_numeric;
+      std::string error;
+  };
+  std::vector<RangeDictionary> dictionaries(resp.ranges.size());
+  pool.parallel_for(resp.ranges.size(), 1, [&](size_t begin, size_t end) {
+    for (auto r{begin}; r < end; ++r) {
+      auto range = resp.ranges[r];
+      auto &dict = dictionaries[r];
+      std::string_view line;
+      while (detail::pop_line(range, line)) {
+        if (line.empty())
+          continue;
+        if (line.find(separator) == std::string_view::npos) {
+          dict.error = "Separator not found!";
+          break;
         }
+        if (dict.n_rows == 0) {
+          dict.n_cols = detail::count_fields(line, separator);
+          dict.values.resize(dict.n_cols);
+          dict.has_numeric.resize(dict.n_cols);
+        }
+        auto cols = detail::for_each_field(line, separator, [&](size_t j, std::string_view field) {
+          if (j >= dict.n_cols)
+            return;
+          if (is_numeric_field(field))
+            dict.has_numeric[j] = 1;
+          else
+            dict.values[j].emplace(field);
+        });
+        if (cols != dict.n_cols) {
+          dict.error = "Inconsistent number of columns!";
+          break;
+        }
+        ++dict.n_rows;
       }
-      ++col;
     }
-    if (n_cols != 0 && col != n_cols) {
-      rf.close();
+  });
+
+  // Ranges follow the file order, so the first error found is the one of the earliest line
+  for (auto &dict : dictionaries)
+    if (!dict.error.empty())
+      throw MatrixIOError(dict.error);
+
+  std::vector<std::unordered_set<std::string_view>> values;
+  std::vector<char> has_numeric;
+  for (size_t r{0}; r < resp.ranges.size(); ++r) {
+    auto &dict = dictionaries[r];
+    resp.first_rows.emplace_back(resp.n_rows);
+    resp.n_rows += dict.n_rows;
+    if (dict.n_rows == 0)
+      continue;
+    if (resp.n_cols == 0) {
+      resp.n_cols = dict.n_cols;
+      values.resize(resp.n_cols);
+      has_numeric.resize(resp.n_cols);
+    }
+    if (dict.n_cols != resp.n_cols)
       throw MatrixIOError("Inconsistent number of columns!");
+    for (size_t j{0}; j < resp.n_cols; ++j) {
+      values[j].merge(dict.values[j]);
+      has_numeric[j] |= dict.has_numeric[j];
     }
-    n_cols = col;
-    col = 0;
   }
-  rf.close();
-  return resp;
-}
 
-std::string MatrixIO::build_target_header(
-    const std::filesystem::path &source_path, char separator, bool has_header,
-    const std::map<size_t, std::unordered_set<std::string>> &lookups_map) {
-  std::ifstream rf{source_path};
+  if (has_header && !header.empty()) {
+    detail::for_each_field(header, separator,
+                           [&](size_t, std::string_view field) { resp.names.emplace_back(field); });
+    if (resp.n_cols == 0)
+      resp.n_cols = resp.names.size();
+    if (resp.names.size() != resp.n_cols)
+      throw MatrixIOError("Inconsistent number of columns!");
+  }
+  if (resp.n_cols == 0)
+    throw MatrixIOError("File can not be empty!");
 
-  if (!rf.is_open())
-    throw MatrixIOError("Could not open file to read!");
+  resp.categories.resize(resp.n_cols);
+  resp.ids.resize(resp.n_cols);
+  for (size_t j{0}; j < values.size(); ++j) {
+    if (values[j].empty())
+      continue;
+    if (has_numeric[j])
+      throw MatrixIOError("Different types in the same column!");
+    auto &categories = resp.categories[j];
+    categories.assign(std::begin(values[j]), std::end(values[j]));
+    std::sort(std::begin(categories), std::end(categories));
+    for (size_t k{0}; k < categories.size(); ++k)
+      resp.ids[j].emplace(categories[k], k);
+  }
+  for (auto &categories : resp.categories)
+    resp.n_encoded_cols += std::max(categories.size(), size_t{1});
 
-  std::string line;
-  std::string word;
-  size_t col{0};
-
-  std::getline(rf, line);
-  col = 0;
-  std::string resp{""};
-  std::stringstream line_stream{line};
-  while (std::getline(line_stream, word, separator)) {
-    if (!has_header)
-      word = "col_" + std::to_string(col);
+  return resp;
+}
+
+std::string build_one_hot_header(const OneHotLayout &layout, char separator) {
+  std::string resp;
+  auto append = [&resp, separator](std::string_view name) {
     if (!resp.empty())
       resp += separator;
-    auto item = lookups_map.find(col);
-    if (item != std::end(lookups_map)) {
-      auto &lookup_set = lookups_map.find(col)->second;
-      for (auto &item : lookup_set) {
-        if (resp.back() != ',')
-          resp += separator;
-        resp += word + "_" + item;
-      }
-    } else
-      resp += word;
-    ++col;
+    resp += name;
+  };
+
+  for (size_t j{0}; j < layout.n_cols; ++j) {
+    auto name = layout.names.empty() ? "col_" + std::to_string(j) : std::string{layout.names[j]};
+    if (layout.categories[j].empty())
+      append(name);
+    for (auto &category : layout.categories[j])
+      append(name + "_" + std::string{category});
   }
-
-  rf.close();
   return resp;
 }
 
+} // namespace
+
 txeo::MatrixIO MatrixIO::one_hot_encode_text_file(const std::filesystem::path &source_path,
                                                   char separator, bool has_header,
                                                   const std::filesystem::path &target_path,
@@ -232,65 +484,115 @@ txeo::MatrixIO MatrixIO::one_hot_encode_text_file(const std::filesystem::path &s
   if (source_path == target_path)
     throw MatrixIOError("Source and target paths cannot be equal!");
 
-  std::ifstream rf{source_path};
-  std::ofstream wf{target_path};
-
-  if (!rf.is_open())
+  detail::MappedFile source{source_path};
+  if (!source.is_open())
     throw MatrixIOError("Could not open file to read!");
 
+  auto layout = build_one_hot_layout(source.text(), separator, has_header);
+
+  std::ofstream wf{target_path, std::ios::out | std::ios::binary};
   if (!wf.is_open())
     throw MatrixIOError("Could not open file to write!");
 
-  auto lookups_map = MatrixIO::build_lookups_map(source_path, separator, has_header);
-
-  auto target_header =
-      MatrixIO::build_target_header(source_path, separator, has_header, lookups_map);
-
   logger.info("Building one-hot-encoded file...");
 
-  wf << target_header << "\n";
-
-  std::string line;
-  std::string word;
-  size_t col{0};
-  if (has_header)
-    std::getline(rf, line);
+  auto header = build_one_hot_header(layout, separator);
+  header += '\n';
+  wf.write(header.data(), static_cast<std::streamsize>(header.size()));
+
+  // Every category becomes a copy of the zero pattern of its column with a single '1' set
+  std::vector<std::string> patterns(layout.n_cols);
+  for (size_t j{0}; j < layout.n_cols; ++j) {
+    for (size_t k{0}; k < layout.categories[j].size(); ++k) {
+      if (k != 0)
+        patterns[j] += separator;
+      patterns[j] += '0';
+    }
+  }
 
-  std::string target_line{""};
-  std::stringstream line_stream{line};
-  while (std::getline(rf, line)) {
-    if (line.empty())
-      continue;
-    std::stringstream line_stream{line};
-    col = 0;
-    target_line = "";
-    while (std::getline(line_stream, word, separator)) {
-      if (!target_line.empty())
-        target_line += separator;
-      if (!detail::is_numeric(word)) {
-        auto &lookup_set = lookups_map.find(col)->second;
-        for (auto &item : lookup_set) {
-          if (target_line.back() != ',')
-            target_line += separator;
-          if (item == word)
-            target_line += "1";
-          else
-            target_line += "0";
+  auto &pool = detail::ThreadPool::instance();
+  std::vector<std::string> blocks(pool.size());
+  for (size_t wave{0}; wave < layout.ranges.size(); wave += blocks.size()) {
+    auto n_blocks = std::min(blocks.size(), layout.ranges.size() - wave);
+    pool.parallel_for(n_blocks, 1, [&](size_t begin, size_t end) {
+      for (auto b{begin}; b < end; ++b) {
+        auto range = layout.ranges[wave + b];
+        auto &block = blocks[b];
+        block.clear();
+        std::string_view line;
+        while (detail::pop_line(range, line)) {
+          if (line.empty())
+            continue;
+          detail::for_each_field(line, separator, [&](size_t j, std::string_view field) {
+            if (j != 0)
+              block += separator;
+            if (layout.categories[j].empty()) {
+              block += field;
+              return;
+            }
+            auto pos = block.size();
+            block += patterns[j];
+            block[pos + 2 * layout.ids[j].find(field)->second] = '1';
+          });
+          block += '\n';
         }
-      } else
-        target_line += word;
-      ++col;
-    }
-    wf << target_line << "\n";
+      }
+    });
+    for (size_t b{0}; b < n_blocks; ++b)
+      wf.write(blocks[b].data(), static_cast<std::streamsize>(blocks[b].size()));
   }
+  if (!wf)
+    throw MatrixIOError("Could not write file!");
   wf.close();
-  rf.close();
 
   MatrixIO resp{target_path, separator};
 
   return resp;
 }
 
+template <typename T>
+Matrix<T> MatrixIO::one_hot_encode_matrix(const std::filesystem::path &source_path,
+                                          char separator, bool has_header, txeo::Logger &logger) {
+  detail::MappedFile source{source_path};
+  if (!source.is_open())
+    throw MatrixIOError("Could not open file to read!");
+
+  auto layout = build_one_hot_layout(source.text(), separator, has_header);
+
+  logger.info("Building one-hot-encoded matrix...");
+
+  Matrix<T> resp{layout.n_rows, layout.n_encoded_cols};
+  auto *data = resp.data();
+  detail::ThreadPool::instance().parallel_for(layout.ranges.size(), 1, [&](size_t begin,
+                                                                          size_t end) {
+    for (auto r{begin}; r < end; ++r) {
+      auto range = layout.ranges[r];
+      auto *row = data + layout.first_rows[r] * layout.n_encoded_cols;
+      std::string_view line;
+      while (detail::pop_line(range, line)) {
+        if (line.empty())
+          continue;
+        auto *item = row;
+        detail::for_each_field(line, separator, [&](size_t j, std::string_view field) {
+          auto n_categories = layout.categories[j].size();
+          if (n_categories == 0) {
+            double value{0};
+            detail::parse_number(field, value);
+            *item++ = static_cast<T>(value);
+            return;
+          }
+          std::fill_n(item, n_categories, T{0});
+          item[layout.ids[j].find(field)->second] = T{1};
+          item += n_categories;
+        });
+        row += layout.n_encoded_cols;
+      }
+    }
+  });
+
+  return resp;
+}
+
 template Matrix<short> MatrixIO::read_text_file<short>(bool has_header) const;
 template Matrix<int> MatrixIO::read_text_file<int>(bool has_header) const;
 template Matrix<bool> MatrixIO::read_text_file<bool>(bool has_header) const;
@@ -300,6 +602,16 @@ template Matrix<float> MatrixIO::read_text_file<float>(bool has_header) const;
 template Matrix<double> MatrixIO::read_text_file<double>(bool has_header) const;
 template Matrix<size_t> MatrixIO::read_text_file<size_t>(bool has_header) const;
 
+template Matrix<short> MatrixIO::read_text_file<short>(bool has_header, size_t num_threads) const;
+template Matrix<int> MatrixIO::read_text_file<int>(bool has_header, size_t num_threads) const;
+template Matrix<bool> MatrixIO::read_text_file<bool>(bool has_header, size_t num_threads) const;
+template Matrix<long> MatrixIO::read_text_file<long>(bool has_header, size_t num_threads) const;
+template Matrix<long long> MatrixIO::read_text_file<long long>(bool has_header,
+                                                               size_t num_threads) const;
+template Matrix<float> MatrixIO::read_text_file<float>(bool has_header, size_t num_threads) const;
+template Matrix<double> MatrixIO::read_text_file<double>(bool has_header, size_t num_threads) const;
+template Matrix<size_t> MatrixIO::read_text_file<size_t>(bool has_header, size_t num_threads) const;
+
 template void MatrixIO::write_text_file(const Matrix<short> &tensor) const;
 template void MatrixIO::write_text_file(const Matrix<int> &tensor) const;
 template void MatrixIO::write_text_file(const Matrix<bool> &tensor) const;
@@ -309,6 +621,52 @@ template void MatrixIO::write_text_file(const Matrix<float> &tensor) const;
 template void MatrixIO::write_text_file(const Matrix<double> &tensor) const;
 template void MatrixIO::write_text_file(const Matrix<size_t> &tensor) const;
 
+template Matrix<short> MatrixIO::one_hot_encode_matrix<short>(const std::filesystem::path &,
+                                                               char, bool, txeo::Logger &);
+template Matrix<int> MatrixIO::one_hot_encode_matrix<int>(const std::filesystem::path &, char,
+                                                           bool, txeo::Logger &);
+template Matrix<bool> MatrixIO::one_hot_encode_matrix<bool>(const std::filesystem::path &, char,
+                                                             bool, txeo::Logger &);
+template Matrix<long> MatrixIO::one_hot_encode_matrix<long>(const std::filesystem::path &, char,
+                                                             bool, txeo::Logger &);
+template Matrix<long long>
+MatrixIO::one_hot_encode_matrix<long long>(const std::filesystem::path &, char, bool,
+                                           txeo::Logger &);
+template Matrix<float> MatrixIO::one_hot_encode_matrix<float>(const std::filesystem::path &, char,
+                                                               bool, txeo::Logger &);
+template Matrix<double> MatrixIO::one_hot_encode_matrix<double>(const std::filesystem::path &,
+                                                                 char, bool, txeo::Logger &);
+template Matrix<size_t> MatrixIO::one_hot_encode_matrix<size_t>(const std::filesystem::path &,
+                                                                 char, bool, txeo::Logger &);
+
+template void MatrixIO::write_columnar_file(const Matrix<short> &matrix) const;
+template void MatrixIO::write_columnar_file(const Matrix<int> &matrix) const;
+template void MatrixIO::write_columnar_file(const Matrix<bool> &matrix) const;
+template void MatrixIO::write_columnar_file(const Matrix<long> &matrix) const;
+template void MatrixIO::write_columnar_file(const Matrix<long long> &matrix) const;
+template void MatrixIO::write_columnar_file(const Matrix<float> &matrix) const;
+template void MatrixIO::write_columnar_file(const Matrix<double> &matrix) const;
+template void MatrixIO::write_columnar_file(const Matrix<size_t> &matrix) const;
+
+template Matrix<short> MatrixIO::read_columnar_file<short>() const;
+template Matrix<int> MatrixIO::read_columnar_file<int>() const;
+template Matrix<bool> MatrixIO::read_columnar_file<bool>() const;
+template Matrix<long> MatrixIO::read_columnar_file<long>() const;
+template Matrix<long long> MatrixIO::read_columnar_file<long long>() const;
+template Matrix<float> MatrixIO::read_columnar_file<float>() const;
+template Matrix<double> MatrixIO::read_columnar_file<double>() const;
+template Matrix<size_t> MatrixIO::read_columnar_file<size_t>() const;
+
+template Matrix<short> MatrixIO::read_columnar_file<short>(const std::vector<size_t> &cols) const;
+template Matrix<int> MatrixIO::read_columnar_file<int>(const std::vector<size_t> &cols) const;
+template Matrix<bool> MatrixIO::read_columnar_file<bool>(const std::vector<size_t> &cols) const;
+template Matrix<long> MatrixIO::read_columnar_file<long>(const std::vector<size_t> &cols) const;
+template Matrix<long long>
+MatrixIO::read_columnar_file<long long>(const std::vector<size_t> &cols) const;
+template Matrix<float> MatrixIO::read_columnar_file<float>(const std::vector<size_t> &cols) const;
+template Matrix<double> MatrixIO::read_columnar_file<double>(const std::vector<size_t> &cols) const;
+template Matrix<size_t> MatrixIO::read_columnar_file<size_t>(const std::vector<size_t> &cols) const;
+
 template void MatrixIO::write_text_file(const Matrix<float> &tensor, size_t precision) const;
 template void MatrixIO::write_text_file(const Matrix<double> &tensor, size_t precision) const;
 
@@ -2,9 +2,12 @@
 #include "txeo/Loss.h"
 #include "txeo/Matrix.h"
 #include "txeo/TensorAgg.h"
+#include "txeo/TensorAllocator.h"
+#include "txeo/TensorExpr.h"
 #include "txeo/TensorFunc.h"
 #include "txeo/TensorOp.h"
 #include "txeo/TensorPart.h"
+#include "txeo/detail/Gemm.h"
 
 #include <cmath>
 #include <limits>
@@ -41,26 +44,62 @@ void OlsGDTrainer<T>::train(size_t epochs, LossFunc metric) {
 
   this->_logger->info("OLS training started...");
 
+  // The epochs create and drop temporaries of a few fixed shapes, which the pool recycles. The
+  // buffers left in the pool of this thread are returned to the system when training ends, after
+  // the scope and every temporary declared below it are gone
+  struct PoolTrimmer {
+      ~PoolTrimmer() { PoolAllocator::instance().trim(); }
+  } trimmer;
+  AllocatorScope scope{PoolAllocator::instance()};
+
   auto &dt_norm = this->_data_table_norm;
   auto &dt = *this->_data_table;
 
-  auto &&x_train = this->_is_norm_enabled ? dt_norm.x_train_normalized() : dt.x_train();
-  auto &&y_train = this->_data_table->y_train();
+  // Input and Output data variables
+  size_t n = dt.x_dim();
+  size_t m = dt.y_dim();
+
+  // Statistics of the training data: Z = X^T X, K = Y X and the norms of X and Y
+  Matrix<T> Z{n + 1, n + 1, 0};
+  Matrix<T> K{m, n + 1, 0};
+  T norm_X{0};
+  T norm_Y{0};
+  if (_train_batches == nullptr) {
+    auto &&x_train = this->_is_norm_enabled ? dt_norm.x_train_normalized() : dt.x_train();
+    auto X = Matrix<T>::to_matrix(TensorPart<T>::increase_dimension(x_train, 1, 1.0));
+    auto Y = TensorFunc<T>::transpose(dt.y_train());
+    Z = TensorFunc<T>::compute_gram_matrix(X);
+    K = Y.dot(X);
+    norm_X = TensorAgg<T>::reduce_euclidean_norm(X, {0, 1})();
+    norm_Y = TensorAgg<T>::reduce_euclidean_norm(Y, {0, 1})();
+  } else {
+    // The features of the batches are normalized with the parameters fitted on the data table
+    size_t n_batches{0};
+    for (const auto &batch : *_train_batches) {
+      auto x = TensorPart<T>::sub_matrix_cols(batch, _batch_x_cols);
+      if (this->_is_norm_enabled)
+        x = dt_norm.normalize(std::move(x));
+      auto X = Matrix<T>::to_matrix(TensorPart<T>::increase_dimension(x, 1, 1.0));
+      auto Y = TensorFunc<T>::transpose(TensorPart<T>::sub_matrix_cols(batch, _batch_y_cols));
+      Z += TensorFunc<T>::compute_gram_matrix(X);
+      K += Y.dot(X);
+      norm_X += X.inner(X);
+      norm_Y += Y.inner(Y);
+      ++n_batches;
+    }
+    if (n_batches == 0)
+      throw OlsGDTrainerError("Training batches are empty.");
+    norm_X = std::sqrt(norm_X);
+    norm_Y = std::sqrt(norm_Y);
+    this->_logger->debug(std::format("Training statistics accumulated from {} batches", n_batches));
+  }
 
+  // Without evaluation data the loss is measured on the training matrices of the data table, which
+  // set_train_batches rules out for batched training
   auto &&x_eval = dt.has_eval()
                       ? (this->_is_norm_enabled ? dt_norm.x_eval_normalized() : *dt.x_eval())
-                      : x_train;
-  auto &&y_eval = dt.has_eval() ? *dt.y_eval() : y_train;
-
-  // Input and Output data variables
-  size_t n = x_train.shape().axis_dim(1);
-  size_t m = y_train.shape().axis_dim(1);
-
-  auto &&X = Matrix<T>::to_matrix(TensorPart<T>::increase_dimension(x_train, 1, 1.0));
-  auto &&Y = TensorFunc<T>::transpose(y_train);
-
-  auto &&Z = TensorFunc<T>::compute_gram_matrix(X);
-  auto &&K = Y.dot(X);
+                      : (this->_is_norm_enabled ? dt_norm.x_train_normalized() : dt.x_train());
+  auto &&y_eval = dt.has_eval() ? *dt.y_eval() : dt.y_train();
 
   _is_converged = false;
 
@@ -69,15 +108,13 @@ void OlsGDTrainer<T>::train(size_t epochs, LossFunc metric) {
   Loss<T> loss{y_eval, metric};
 
   // Initial Guesses
-  T norm_X = TensorAgg<T>::reduce_euclidean_norm(X, {0, 1})();
-  T norm_Y = TensorAgg<T>::reduce_euclidean_norm(Y, {0, 1})();
   Matrix<T> B_prev{m, n + 1, norm_Y / norm_X};
 
   if (_variable_lr)
     _learning_rate = 1.0 / (norm_X * norm_X);
 
-  auto B = B_prev - (_learning_rate * (B_prev.dot(Z) - K));
-  auto L = B - B_prev;
+  Matrix<T> B = B_prev - _learning_rate * (lazy(B_prev.dot(Z)) - K);
+  Matrix<T> L = lazy(B) - B_prev;
 
   // Declaring variables to capture trainer params
   T loss_value = std::numeric_limits<T>::max();
@@ -87,10 +124,19 @@ void OlsGDTrainer<T>::train(size_t epochs, LossFunc metric) {
   Matrix<T> B_best{};
   bool found_best{false};
 
+  // Evaluation predictions, computed as X_eval * B^T without materializing the transpose
+  auto eval_rows = X_eval.row_size();
+  bool is_native_pred = detail::use_native_gemm<T>(eval_rows, m, n + 1);
+  Matrix<T> pred(eval_rows, m);
+
   // Iterate OLS
   for (size_t e{0}; e < epochs; ++e) {
-    auto &&B_t = TensorFunc<T>::transpose(B);
-    loss_value = loss.get_loss(TensorOp<T>::product_tensors(X_eval, B_t));
+    if (is_native_pred)
+      detail::gemm(false, true, eval_rows, m, n + 1, X_eval.data(), B.data(), pred.data());
+    else
+      pred = Matrix<T>::to_matrix(
+          TensorOp<T>::product_tensors(X_eval, TensorFunc<T>::transpose(B)));
+    loss_value = loss.get_loss(pred);
     this->_logger->debug(
         std::format("Epoch {}, Loss {}, Learning Rate {}", e, loss_value, _learning_rate));
     if (std::isnan(loss_value)) {
@@ -124,8 +170,8 @@ void OlsGDTrainer<T>::train(size_t epochs, LossFunc metric) {
       auto LZ = L.dot(Z);
       _learning_rate = std::fabs(L.inner(LZ)) / LZ.inner(LZ);
     };
-    B -= _learning_rate * (B.dot(Z) - K);
-    L = B - B_prev;
+    B -= _learning_rate * (lazy(B.dot(Z)) - K);
+    L = lazy(B) - B_prev;
   }
 
   if (found_best) {
@@ -139,6 +185,38 @@ void OlsGDTrainer<T>::train(size_t epochs, LossFunc metric) {
   this->_logger->info("OLS training finished...");
 }
 
+template <typename T>
+  requires(std::floating_point<T>)
+void OlsGDTrainer<T>::set_train_batches(MatrixBatches<T> &batches, std::vector<size_t> x_cols,
+                                        std::vector<size_t> y_cols) {
+  auto &dt = *this->_data_table;
+  if (!dt.has_eval())
+    throw OlsGDTrainerError("Training batches require evaluation data in the data table.");
+  if (x_cols.size() != dt.x_dim() || y_cols.size() != dt.y_dim())
+    throw OlsGDTrainerError("Inconsistent batch columns.");
+  auto n_cols = batches.col_size();
+  for (auto col : x_cols)
+    if (col >= n_cols)
+      throw OlsGDTrainerError("Feature column out of range of the batches.");
+  for (auto col : y_cols)
+    if (col >= n_cols)
+      throw OlsGDTrainerError("Output column out of range of the batches.");
+
+  this->_is_trained = false;
+  _train_batches = &batches;
+  _batch_x_cols = std::move(x_cols);
+  _batch_y_cols = std::move(y_cols);
+}
+
+template <typename T>
+  requires(std::floating_point<T>)
+void OlsGDTrainer<T>::clear_train_batches() {
+  this->_is_trained = false;
+  _train_batches = nullptr;
+  _batch_x_cols.clear();
+  _batch_y_cols.clear();
+}
+
 template <typename T>
   requires(std::floating_point<T>)
 const Matrix<T> &OlsGDTrainer<T>::weight_bias() const {
@@ -4,22 +4,153 @@
 #include "txeo/detail/TensorPrivate.h"
 #include "txeo/detail/utils.h"
 
+#include <chrono>
+#include <format>
+#include <sstream>
 #include <tensorflow/cc/saved_model/tag_constants.h>
 #include <tensorflow/core/framework/tensor.h>
 #include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 namespace tf = tensorflow;
 
 namespace txeo {
 
+namespace {
+
+// Restricts the calling thread to some CPUs while alive, so that threads it creates inherit them
+class ThreadAffinityScope {
+  public:
+    ThreadAffinityScope(const ThreadAffinityScope &) = delete;
+    ThreadAffinityScope &operator=(const ThreadAffinityScope &) = delete;
+
+    explicit ThreadAffinityScope(const std::vector<size_t> &cpus) {
+#ifdef __linux__
+      if (cpus.empty())
+        return;
+      cpu_set_t set;
+      CPU_ZERO(&set);
+      for (auto cpu : cpus)
+        if (cpu < CPU_SETSIZE)
+          CPU_SET(cpu, &set);
+      _active = pthread_getaffinity_np(pthread_self(), sizeof(_saved), &_saved) == 0 &&
+                pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#endif
+    }
+
+    ~ThreadAffinityScope() {
+#ifdef __linux__
+      if (_active)
+        pthread_setaffinity_np(pthread_self(), sizeof(_saved), &_saved);
+#endif
+    }
+
+  private:
+#ifdef __linux__
+    cpu_set_t _saved{};
+    bool _active{false};
+#endif
+};
+
+void apply_config(const PredictorConfig &config, tf::ConfigProto &proto) {
+  if (config.use_per_session_threads && !config.shared_inter_op_pool.empty())
+    throw PredictorError("A shared inter-op pool can not be used with per-session threads!");
+
+  auto intra_op_threads = config.intra_op_threads;
+  if (intra_op_threads == 0)
+    intra_op_threads = config.cpu_affinity.size();
+  proto.set_intra_op_parallelism_threads(detail::to_int(intra_op_threads));
+  proto.set_inter_op_parallelism_threads(detail::to_int(config.inter_op_threads));
+  proto.set_use_per_session_threads(config.use_per_session_threads);
+  proto.clear_session_inter_op_thread_pool();
+  if (!config.shared_inter_op_pool.empty()) {
+    auto *pool = proto.add_session_inter_op_thread_pool();
+    pool->set_num_threads(detail::to_int(config.inter_op_threads));
+    pool->set_global_name(config.shared_inter_op_pool);
+  }
+
+  proto.mutable_gpu_options()->set_allow_growth(config.allow_gpu_memory_growth);
+  auto *optimizer = proto.mutable_graph_options()->mutable_optimizer_options();
+  optimizer->set_opt_level(config.optimize_graph ? tf::OptimizerOptions::L1
+                                                 : tf::OptimizerOptions::L0);
+  optimizer->set_do_common_subexpression_elimination(config.optimize_graph);
+  optimizer->set_do_function_inlining(config.optimize_graph);
+  optimizer->set_do_constant_folding(config.constant_folding);
+  optimizer->set_global_jit_level(config.enable_xla ? tf::OptimizerOptions::ON_1
+                                                    : tf::OptimizerOptions::OFF);
+}
+
+} // namespace
+
+template <typename T>
+tf::Session::CallableHandle Predictor<T>::Impl::callable(const std::vector<std::string> &feeds,
+                                                         const std::vector<std::string> &fetches) {
+  std::string key;
+  for (const auto &name : feeds)
+    key += name + '\n';
+  key += '\n';
+  for (const auto &name : fetches)
+    key += name + '\n';
+
+  std::lock_guard lock{callables_mutex};
+  if (auto it = callables.find(key); it != callables.end())
+    return it->second;
+
+  tf::CallableOptions options;
+  for (const auto &name : feeds)
+    options.add_feed(name);
+  for (const auto &name : fetches)
+    options.add_fetch(name);
+  tf::Session::CallableHandle handle{0};
+  auto status = model.session->MakeCallable(options, &handle);
+  if (!status.ok())
+    throw PredictorError("Error preparing model call: " + status.ToString());
+  callables.emplace(std::move(key), handle);
+
+  return handle;
+}
+
+template <typename T>
+void Predictor<T>::Impl::release_callables() {
+  std::lock_guard lock{callables_mutex};
+  for (auto &item : callables) {
+    auto aux = model.session->ReleaseCallable(item.second);
+  }
+  callables.clear();
+}
+
+template <typename T>
+tf::Status Predictor<T>::Impl::run(const std::vector<std::string> &feeds,
+                                   const std::vector<tf::Tensor> &feed_tensors,
+                                   const std::vector<std::string> &fetches,
+                                   std::vector<tf::Tensor> *outputs) {
+  if (use_callables)
+    return model.session->RunCallable(callable(feeds, fetches), feed_tensors, outputs, nullptr);
+
+  std::vector<std::pair<std::string, tf::Tensor>> named_feeds;
+  for (size_t i{0}; i < feeds.size(); ++i)
+    named_feeds.emplace_back(feeds[i], feed_tensors[i]);
+
+  return model.session->Run(named_feeds, fetches, {}, outputs);
+}
+
 template <typename T>
 void Predictor<T>::load_model() {
   std::unordered_set<std::string> tags{static_cast<const char *>(tf::kSavedModelTagServe)};
-  tensorflow::ConfigProto *config = &_impl->session_options.config;
-  config->mutable_gpu_options()->set_allow_growth(true);
-
-  tf::Status status = tf::LoadSavedModel(_impl->session_options, _impl->run_options,
-                                         _impl->model_path, tags, &_impl->model);
+  apply_config(_impl->config, _impl->session_options.config);
+
+  auto start = std::chrono::steady_clock::now();
+  tf::Status status;
+  {
+    ThreadAffinityScope affinity{_impl->config.cpu_affinity};
+    status = tf::LoadSavedModel(_impl->session_options, _impl->run_options, _impl->model_path,
+                                tags, &_impl->model);
+  }
   if (!status.ok())
     throw PredictorError("Error loading model: " + status.ToString());
 
@@ -31,6 +162,9 @@ void Predictor<T>::load_model() {
   if (signature_map.outputs().size() == 0)
     throw PredictorError("The loaded model has no output metadata!");
 
+  _impl->in_name_shape_map.clear();
+  _impl->out_name_shape_map.clear();
+
   for (const auto &input : signature_map.inputs()) {
     auto info = input.second;
     if (info.has_name() && info.has_tensor_shape())
@@ -49,21 +183,40 @@ void Predictor<T>::load_model() {
       _impl->out_name_shape_map.emplace_back(info.name(), TensorShape({0}));
   }
 
-  _logger->info("Model loaded successfully");
+  _impl->predict_callable =
+      _impl->callable({_impl->in_name_shape_map[0].first}, {_impl->out_name_shape_map[0].first});
+
+  std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+  _logger->info(std::format("Model loaded successfully in {:.1f} ms", elapsed.count()));
+
+  if (!_impl->config.warmup_batch_sizes.empty())
+    this->warmup(_impl->config.warmup_batch_sizes, _impl->config.warmup_runs);
 }
 
 template <typename T>
 Predictor<T>::Predictor(std::filesystem::path model_path, txeo::Logger &logger)
+    : Predictor{std::move(model_path), PredictorConfig{}, logger} {}
+
+template <typename T>
+Predictor<T>::Predictor(std::filesystem::path model_path, const PredictorConfig &config,
+                        txeo::Logger &logger)
     : _impl{std::make_unique<Impl>()}, _logger{&logger} {
   _impl->model_path = model_path;
+  _impl->config = config;
   this->load_model();
 }
 
 template <typename T>
 Predictor<T>::~Predictor() {
+  _impl->release_callables();
   auto aux = _impl->model.session->Close();
 }
 
+template <typename T>
+const PredictorConfig &Predictor<T>::config() const noexcept {
+  return _impl->config;
+}
+
 template <typename T>
 const Predictor<T>::TensorInfo &Predictor<T>::get_input_metadata() const noexcept {
   return _impl->in_name_shape_map;
@@ -93,13 +246,17 @@ Tensor<T> Predictor<T>::predict(const Tensor<T> &input) const {
   const auto &tf_tensor = *input._impl->tf_tensor;
   std::vector<tf::Tensor> outputs;
 
-  _logger->info("Prediction started...");
+  _logger->debug("Prediction started...");
 
-  auto status = _impl->model.session->Run({{input_name, tf_tensor}}, {output_name}, {}, &outputs);
+  auto status =
+      _impl->use_callables
+          ? _impl->model.session->RunCallable(_impl->predict_callable, {tf_tensor}, &outputs,
+                                              nullptr)
+          : _impl->model.session->Run({{input_name, tf_tensor}}, {output_name}, {}, &outputs);
   if (!status.ok())
-    PredictorError("Error running model: " + status.ToString());
+    throw PredictorError("Error running model: " + status.ToString());
 
-  _logger->info("Prediction finished...");
+  _logger->debug("Prediction finished...");
 
   auto resp = detail::TensorHelper::to_txeo_tensor<T>(std::move(outputs[0]));
 
@@ -124,47 +281,133 @@ std::optional<TensorShape> Predictor<T>::get_output_metadata_shape(const std::st
 
 template <typename T>
 std::vector<Tensor<T>> Predictor<T>::predict_batch(const Predictor<T>::TensorIdent &inputs) const {
-  for (size_t i{0}; i < inputs.size(); ++i) {
-    auto shp = this->get_input_metadata_shape(inputs[i].first);
+  return this->predict_outputs(inputs, {_impl->out_name_shape_map[0].first});
+}
+
+template <typename T>
+std::vector<Tensor<T>>
+Predictor<T>::predict_outputs(const Predictor<T>::TensorIdent &inputs,
+                              const std::vector<std::string> &output_names) const {
+  std::vector<Tensor<T>> resp;
+  this->predict_outputs(inputs, output_names, resp);
+
+  return resp;
+}
+
+template <typename T>
+void Predictor<T>::predict_outputs(const Predictor<T>::TensorIdent &inputs,
+                                   const std::vector<std::string> &output_names,
+                                   std::vector<Tensor<T>> &outputs) const {
+  std::vector<std::string> feeds;
+  std::vector<tf::Tensor> feed_tensors;
+  for (const auto &item : inputs) {
+    auto shp = this->get_input_metadata_shape(item.first);
     if (!shp)
       throw PredictorError("An input name could not be found!");
     if (shp->axis_dim(0) != 0)
-      if (shp != inputs[i].second.shape())
+      if (shp != item.second.shape())
         throw PredictorError("The shape of an input tensor and the model input do not match!");
+    feeds.emplace_back(item.first);
+    feed_tensors.emplace_back(*item.second._impl->tf_tensor);
   }
 
-  std::vector<std::pair<std::string, tf::Tensor>> tf_inputs;
-  for (size_t i{0}; i < inputs.size(); ++i)
-    tf_inputs.emplace_back(inputs[i].first, *inputs[i].second._impl->tf_tensor);
+  std::vector<std::string> fetches;
+  if (output_names.empty())
+    for (const auto &item : _impl->out_name_shape_map)
+      fetches.emplace_back(item.first);
+  else
+    for (const auto &name : output_names) {
+      if (!this->get_output_metadata_shape(name))
+        throw PredictorError("An output name could not be found!");
+      fetches.emplace_back(name);
+    }
 
-  std::vector<tf::Tensor> outputs;
-  auto output_name = _impl->out_name_shape_map[0].first;
+  std::vector<tf::Tensor> tf_outputs;
 
-  _logger->info("Batch prediction started...");
+  _logger->debug("Batch prediction started...");
 
-  auto status = _impl->model.session->Run(tf_inputs, {output_name}, {}, &outputs);
+  auto status = _impl->run(feeds, feed_tensors, fetches, &tf_outputs);
   if (!status.ok())
-    PredictorError("Error running model: " + status.ToString());
-
-  _logger->info("Batch prediction finished...");
-
-  std::vector<Tensor<T>> resp;
-  for (auto &item : outputs)
-    resp.emplace_back(detail::TensorHelper::to_txeo_tensor<T>(std::move(item)));
-
-  return resp;
+    throw PredictorError("Error running model: " + status.ToString());
+
+  _logger->debug("Batch prediction finished...");
+
+  for (const auto &item : tf_outputs)
+    if (item.dtype() != detail::get_tf_dtype<T>())
+      throw PredictorError("The type of a model output and the predictor do not match!");
+
+  // Output tensors share the buffers allocated by the session; existing ones are reused
+  outputs.reserve(tf_outputs.size());
+  for (size_t i{0}; i < tf_outputs.size(); ++i)
+    if (i < outputs.size())
+      detail::TensorHelper::adopt_tf_tensor(outputs[i], std::move(tf_outputs[i]));
+    else
+      outputs.emplace_back(detail::TensorHelper::to_txeo_tensor<T>(std::move(tf_outputs[i])));
+  outputs.resize(tf_outputs.size());
 }
 
 template <typename T>
 void Predictor<T>::enable_xla(bool enable) {
-  _impl->session_options.config.mutable_graph_options()
-      ->mutable_optimizer_options()
-      ->set_global_jit_level(enable ? tensorflow::OptimizerOptions::ON_1
-                                    : tensorflow::OptimizerOptions::OFF);
+  _impl->config.enable_xla = enable;
+  _impl->release_callables();
   auto aux = _impl->model.session->Close();
   this->load_model();
 }
 
+template <typename T>
+void Predictor<T>::enable_callables(bool enable) {
+  _impl->use_callables = enable;
+}
+
+template <typename T>
+void Predictor<T>::warmup(const std::vector<size_t> &batch_sizes, size_t runs) {
+  for (auto batch_size : batch_sizes) {
+    TensorIdent inputs;
+    for (const auto &[name, shape] : _impl->in_name_shape_map) {
+      std::vector<size_t> dims;
+      bool batched{false};
+      for (auto dim : shape.axes_dims()) {
+        if (dim > 0)
+          dims.emplace_back(detail::to_size_t(dim));
+        else {
+          dims.emplace_back(batched ? 1 : batch_size);
+          batched = true;
+        }
+      }
+      inputs.emplace_back(name, Tensor<T>(TensorShape(std::move(dims)), T{0}));
+    }
+    this->warmup_inputs(inputs, runs);
+  }
+}
+
+template <typename T>
+void Predictor<T>::warmup_inputs(const TensorIdent &inputs, size_t runs) {
+  if (runs == 0 || inputs.empty())
+    return;
+
+  auto single = inputs.size() == 1 && inputs[0].first == _impl->in_name_shape_map[0].first;
+  auto all_outputs = !single || _impl->out_name_shape_map.size() > 1;
+  double first_ms{0.0};
+  double last_ms{0.0};
+  for (size_t i{0}; i < runs; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    if (single)
+      [[maybe_unused]] auto output = this->predict(inputs[0].second);
+    if (all_outputs)
+      [[maybe_unused]] auto outputs = this->predict_outputs(inputs, {});
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    if (i == 0)
+      first_ms = elapsed.count();
+    last_ms = elapsed.count();
+  }
+
+  std::ostringstream shapes;
+  for (const auto &item : inputs)
+    shapes << ' ' << item.second.shape();
+  _logger->info(std::format("Warmup of input shapes{}: first run {:.3f} ms, last run {:.3f} ms",
+                            shapes.str(), first_ms, last_ms));
+}
+
 template <typename T>
 std::vector<DeviceInfo> Predictor<T>::get_devices() const {
   std::vector<tensorflow::DeviceAttributes> devices;
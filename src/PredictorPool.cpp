@@ -0,0 +1,147 @@
+#include "txeo/PredictorPool.h"
+#include "txeo/detail/MpmcQueue.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace txeo {
+
+template <typename T>
+struct PredictorPool<T>::Impl {
+    struct Counters {
+        std::atomic<size_t> calls{0};
+        std::atomic<int64_t> busy_ns{0};
+    };
+
+    std::vector<std::unique_ptr<Predictor<T>>> replicas;
+    std::vector<Counters> counters;
+    std::optional<detail::MpmcQueue<size_t>> idle;
+    std::atomic<size_t> releases{0};
+    std::chrono::steady_clock::time_point created;
+
+    size_t acquire();
+    void release(size_t index);
+
+    template <typename F>
+    auto dispatch(F &&func);
+};
+
+template <typename T>
+size_t PredictorPool<T>::Impl::acquire() {
+  size_t index{0};
+  while (!idle->pop(index)) {
+    // A release after this load changes the counter, so the wait below can not miss it
+    auto seen = releases.load(std::memory_order_acquire);
+    if (idle->pop(index))
+      break;
+    releases.wait(seen, std::memory_order_acquire);
+  }
+
+  return index;
+}
+
+template <typename T>
+void PredictorPool<T>::Impl::release(size_t index) {
+  idle->push(index);
+  releases.fetch_add(1, std::memory_order_release);
+  releases.notify_one();
+}
+
+template <typename T>
+template <typename F>
+auto PredictorPool<T>::Impl::dispatch(F &&func) {
+  struct Lease {
+      Impl &impl;
+      size_t index;
+      std::chrono::steady_clock::time_point start{std::chrono::steady_clock::now()};
+
+      ~Lease() {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        impl.counters[index].calls.fetch_add(1, std::memory_order_relaxed);
+        impl.counters[index].busy_ns.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+            std::memory_order_relaxed);
+        impl.release(index);
+      }
+  };
+
+  Lease lease{*this, this->acquire()};
+  return func(*replicas[lease.index]);
+}
+
+template <typename T>
+PredictorPool<T>::PredictorPool(const std::filesystem::path &model_path, size_t replicas,
+                                const PredictorConfig &config, txeo::Logger &logger)
+    : _impl{std::make_unique<Impl>()} {
+  if (replicas == 0)
+    throw PredictorError("The number of replicas must be positive!");
+
+  _impl->replicas.reserve(replicas);
+  for (size_t i{0}; i < replicas; ++i)
+    _impl->replicas.emplace_back(std::make_unique<Predictor<T>>(model_path, config, logger));
+  _impl->counters = std::vector<typename Impl::Counters>(replicas);
+  _impl->idle.emplace(replicas);
+  for (size_t i{0}; i < replicas; ++i)
+    _impl->idle->push(i);
+  _impl->created = std::chrono::steady_clock::now();
+
+  logger.info("Predictor pool loaded with " + std::to_string(replicas) + " replicas");
+}
+
+template <typename T>
+PredictorPool<T>::~PredictorPool() = default;
+
+template <typename T>
+Tensor<T> PredictorPool<T>::predict(const Tensor<T> &input) const {
+  return _impl->dispatch([&input](const Predictor<T> &replica) { return replica.predict(input); });
+}
+
+template <typename T>
+std::vector<Tensor<T>>
+PredictorPool<T>::predict_outputs(const typename Predictor<T>::TensorIdent &inputs,
+                                  const std::vector<std::string> &output_names) const {
+  return _impl->dispatch([&](const Predictor<T> &replica) {
+    return replica.predict_outputs(inputs, output_names);
+  });
+}
+
+template <typename T>
+size_t PredictorPool<T>::size() const {
+  return _impl->replicas.size();
+}
+
+template <typename T>
+const Predictor<T> &PredictorPool<T>::replica(size_t index) const {
+  if (index >= _impl->replicas.size())
+    throw PredictorError("Replica index out of range!");
+  return *_impl->replicas[index];
+}
+
+template <typename T>
+std::vector<typename PredictorPool<T>::ReplicaStats> PredictorPool<T>::replica_stats() const {
+  std::chrono::duration<double> lifetime = std::chrono::steady_clock::now() - _impl->created;
+  std::vector<ReplicaStats> resp;
+  for (const auto &counters : _impl->counters) {
+    ReplicaStats stats;
+    stats.calls = counters.calls.load(std::memory_order_relaxed);
+    auto busy_ns = counters.busy_ns.load(std::memory_order_relaxed);
+    stats.busy_seconds = static_cast<double>(busy_ns) / 1e9;
+    stats.utilization = lifetime.count() > 0.0 ? stats.busy_seconds / lifetime.count() : 0.0;
+    resp.emplace_back(stats);
+  }
+
+  return resp;
+}
+
+template class PredictorPool<short>;
+template class PredictorPool<int>;
+template class PredictorPool<long>;
+template class PredictorPool<long long>;
+template class PredictorPool<float>;
+template class PredictorPool<double>;
+
+} // namespace txeo
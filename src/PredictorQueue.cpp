@@ -0,0 +1,195 @@
+#include "txeo/PredictorQueue.h"
+#include "txeo/TensorShape.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace txeo {
+
+template <typename T>
+struct PredictorQueue<T>::Impl {
+    struct Request {
+        Tensor<T> row;
+        std::promise<Tensor<T>> promise;
+        std::chrono::steady_clock::time_point arrival;
+    };
+
+    const Predictor<T> *predictor{nullptr};
+    size_t max_batch_size{0};
+    std::chrono::microseconds max_wait{0};
+    TensorShape input_shape;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<Request> requests;
+    bool stopping{false};
+    size_t batch_count{0};
+    size_t request_count{0};
+    std::thread worker;
+
+    void work();
+    void run(std::vector<Request> &batch);
+};
+
+template <typename T>
+void PredictorQueue<T>::Impl::work() {
+  std::unique_lock lock{mutex};
+  while (true) {
+    cv.wait(lock, [this]() { return stopping || !requests.empty(); });
+    if (requests.empty())
+      break;
+
+    // Waits for the batch to fill up, but no longer than its oldest request may wait
+    auto deadline = requests.front().arrival + max_wait;
+    cv.wait_until(lock, deadline,
+                  [this]() { return stopping || requests.size() >= max_batch_size; });
+
+    auto n = std::min(requests.size(), max_batch_size);
+    std::vector<Request> batch;
+    batch.reserve(n);
+    std::move(requests.begin(), requests.begin() + n, std::back_inserter(batch));
+    requests.erase(requests.begin(), requests.begin() + n);
+
+    lock.unlock();
+    this->run(batch);
+    lock.lock();
+  }
+}
+
+template <typename T>
+void PredictorQueue<T>::Impl::run(std::vector<Request> &batch) {
+  auto n = batch.size();
+  std::vector<Tensor<T>> rows;
+  rows.reserve(n);
+  std::exception_ptr error;
+  try {
+    auto dims = batch[0].row.shape().axes_dims();
+    dims.insert(dims.begin(), static_cast<int64_t>(n));
+    auto row_dim = batch[0].row.dim();
+
+    Tensor<T> input{TensorShape(std::vector<size_t>(dims.begin(), dims.end()))};
+    auto *input_data = input.data();
+    for (size_t k{0}; k < n; ++k)
+      std::copy_n(std::as_const(batch[k].row).data(), row_dim, input_data + k * row_dim);
+
+    const auto output = predictor->predict(input);
+    if (output.order() == 0 || static_cast<size_t>(output.shape().axis_dim(0)) != n)
+      throw PredictorError("The model output does not have one row per input row!");
+
+    auto out_dims = output.shape().axes_dims();
+    TensorShape row_shape{std::vector<size_t>(out_dims.begin() + 1, out_dims.end())};
+    auto out_row_dim = output.dim() / n;
+    for (size_t k{0}; k < n; ++k) {
+      auto &row = rows.emplace_back(row_shape);
+      std::copy_n(output.data() + k * out_row_dim, out_row_dim, row.data());
+    }
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  // Counted before any promise is fulfilled, so that a caller woken by its future sees its batch
+  {
+    std::scoped_lock lock{mutex};
+    ++batch_count;
+    request_count += n;
+  }
+
+  for (size_t k{0}; k < n; ++k)
+    if (error)
+      batch[k].promise.set_exception(error);
+    else
+      batch[k].promise.set_value(std::move(rows[k]));
+}
+
+template <typename T>
+PredictorQueue<T>::PredictorQueue(const Predictor<T> &predictor, size_t max_batch_size,
+                                  std::chrono::microseconds max_wait)
+    : _impl{std::make_unique<Impl>()} {
+  if (max_batch_size == 0)
+    throw PredictorError("Batch size must be positive!");
+
+  const auto &input_shape = predictor.get_input_metadata()[0].second;
+  if (input_shape.number_of_axes() == 0 || input_shape.axis_dim(0) != 0)
+    throw PredictorError("The model input does not have a variable batch axis!");
+
+  _impl->predictor = &predictor;
+  _impl->max_batch_size = max_batch_size;
+  _impl->max_wait = max_wait;
+  _impl->input_shape = input_shape;
+  _impl->worker = std::thread{[impl = _impl.get()]() { impl->work(); }};
+}
+
+template <typename T>
+PredictorQueue<T>::~PredictorQueue() {
+  {
+    std::lock_guard lock{_impl->mutex};
+    _impl->stopping = true;
+  }
+  _impl->cv.notify_one();
+  _impl->worker.join();
+}
+
+template <typename T>
+std::future<Tensor<T>> PredictorQueue<T>::submit(Tensor<T> row) {
+  const auto &input_shape = _impl->input_shape;
+  if (row.order() + 1 != input_shape.number_of_axes())
+    throw PredictorError("The shape of the input row and the model input do not match!");
+  for (int i{0}; i < row.order(); ++i)
+    if (row.shape().axis_dim(i) != input_shape.axis_dim(i + 1))
+      throw PredictorError("The shape of the input row and the model input do not match!");
+
+  typename Impl::Request request{std::move(row), {}, std::chrono::steady_clock::now()};
+  auto resp = request.promise.get_future();
+  size_t pending{0};
+  {
+    std::lock_guard lock{_impl->mutex};
+    if (_impl->stopping)
+      throw PredictorError("The queue is stopping!");
+    _impl->requests.emplace_back(std::move(request));
+    pending = _impl->requests.size();
+  }
+  // The worker only needs to know when a batch starts or fills up
+  if (pending == 1 || pending == _impl->max_batch_size)
+    _impl->cv.notify_one();
+
+  return resp;
+}
+
+template <typename T>
+size_t PredictorQueue<T>::max_batch_size() const {
+  return _impl->max_batch_size;
+}
+
+template <typename T>
+std::chrono::microseconds PredictorQueue<T>::max_wait() const {
+  return _impl->max_wait;
+}
+
+template <typename T>
+size_t PredictorQueue<T>::batch_count() const {
+  std::lock_guard lock{_impl->mutex};
+  return _impl->batch_count;
+}
+
+template <typename T>
+size_t PredictorQueue<T>::request_count() const {
+  std::lock_guard lock{_impl->mutex};
+  return _impl->request_count;
+}
+
+template class PredictorQueue<short>;
+template class PredictorQueue<int>;
+template class PredictorQueue<long>;
+template class PredictorQueue<long long>;
+template class PredictorQueue<float>;
+template class PredictorQueue<double>;
+
+} // namespace txeo
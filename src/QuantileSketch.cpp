@@ -0,0 +1,178 @@
+#include "txeo/QuantileSketch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace txeo {
+
+namespace {
+
+// Ratio between the capacities of consecutive compactors, from the top level down
+constexpr double capacity_decay{2.0 / 3.0};
+
+} // namespace
+
+template <typename T>
+QuantileSketch<T>::QuantileSketch(size_t k) : _k{k} {
+  if (k < 8)
+    throw QuantileSketchError("The sketch capacity must be at least 8!");
+
+  _levels.resize(1);
+  this->update_max_retained();
+}
+
+template <typename T>
+size_t QuantileSketch<T>::capacity(size_t level) const {
+  auto depth = static_cast<double>(_levels.size() - level - 1);
+  auto resp = std::ceil(static_cast<double>(_k) * std::pow(capacity_decay, depth));
+
+  return std::max<size_t>(static_cast<size_t>(resp), 2);
+}
+
+template <typename T>
+void QuantileSketch<T>::update_max_retained() {
+  _max_retained = 0;
+  for (size_t h{0}; h < _levels.size(); ++h)
+    _max_retained += this->capacity(h);
+}
+
+template <typename T>
+size_t QuantileSketch<T>::retained() const noexcept {
+  return _retained;
+}
+
+template <typename T>
+void QuantileSketch<T>::insert(const T &value) {
+  if (_count == 0)
+    _min = _max = value;
+  else {
+    _min = std::min(_min, value);
+    _max = std::max(_max, value);
+  }
+
+  _levels[0].emplace_back(value);
+  ++_count;
+  ++_retained;
+  while (_retained >= _max_retained)
+    this->compress();
+}
+
+// Halves the lowest full level: its sorted values are paired and one value of each pair, chosen
+// by a shared coin flip, moves to the next level with twice the weight
+template <typename T>
+void QuantileSketch<T>::compress() {
+  size_t h{0};
+  while (_levels[h].size() < this->capacity(h))
+    ++h;
+
+  if (h + 1 == _levels.size()) {
+    _levels.emplace_back();
+    this->update_max_retained();
+  }
+
+  auto &level = _levels[h];
+  auto &next = _levels[h + 1];
+  std::sort(level.begin(), level.end());
+  auto paired = level.size() - level.size() % 2;
+  for (size_t i{static_cast<size_t>(_random() & 1)}; i < paired; i += 2)
+    next.emplace_back(level[i]);
+
+  if (paired < level.size())
+    level.erase(level.begin(), level.begin() + static_cast<std::ptrdiff_t>(paired));
+  else
+    level.clear();
+
+  _retained = 0;
+  for (const auto &item : _levels)
+    _retained += item.size();
+}
+
+template <typename T>
+void QuantileSketch<T>::merge(const QuantileSketch &other) {
+  if (other._k != _k)
+    throw QuantileSketchError("Sketches of different capacities can not be merged!");
+  if (&other == this) {
+    auto aux = other;
+    this->merge(aux);
+    return;
+  }
+  if (other._count == 0)
+    return;
+
+  if (_count == 0) {
+    _min = other._min;
+    _max = other._max;
+  } else {
+    _min = std::min(_min, other._min);
+    _max = std::max(_max, other._max);
+  }
+
+  if (_levels.size() < other._levels.size()) {
+    _levels.resize(other._levels.size());
+    this->update_max_retained();
+  }
+  for (size_t h{0}; h < other._levels.size(); ++h)
+    _levels[h].insert(_levels[h].end(), other._levels[h].begin(), other._levels[h].end());
+  _count += other._count;
+  _retained += other._retained;
+
+  while (_retained >= _max_retained)
+    this->compress();
+}
+
+template <typename T>
+T QuantileSketch<T>::quantile(double q) const {
+  return this->quantiles({q})[0];
+}
+
+template <typename T>
+std::vector<T> QuantileSketch<T>::quantiles(const std::vector<double> &qs) const {
+  if (_count == 0)
+    throw QuantileSketchError("The sketch is empty!");
+  for (auto &q : qs)
+    if (!(q >= 0.0 && q <= 1.0))
+      throw QuantileSketchError("Quantiles must lie in [0, 1]!");
+
+  std::vector<std::pair<T, size_t>> items;
+  items.reserve(_retained);
+  for (size_t h{0}; h < _levels.size(); ++h)
+    for (const auto &value : _levels[h])
+      items.emplace_back(value, size_t{1} << h);
+  std::sort(items.begin(), items.end(),
+            [](const auto &left, const auto &right) { return left.first < right.first; });
+
+  std::vector<double> cumulative(items.size());
+  double acc{0.0};
+  for (size_t i{0}; i < items.size(); ++i) {
+    acc += static_cast<double>(items[i].second);
+    cumulative[i] = acc;
+  }
+
+  std::vector<T> resp;
+  resp.reserve(qs.size());
+  for (auto &q : qs) {
+    if (q == 0.0) {
+      resp.emplace_back(_min);
+      continue;
+    }
+    auto target = q * static_cast<double>(_count);
+    auto it = std::upper_bound(cumulative.begin(), cumulative.end(), target);
+    resp.emplace_back(it == cumulative.end() ? _max : items[it - cumulative.begin()].first);
+  }
+
+  return resp;
+}
+
+template class QuantileSketch<short>;
+template class QuantileSketch<int>;
+template class QuantileSketch<bool>;
+template class QuantileSketch<long>;
+template class QuantileSketch<long long>;
+template class QuantileSketch<float>;
+template class QuantileSketch<double>;
+template class QuantileSketch<size_t>;
+
+} // namespace txeo
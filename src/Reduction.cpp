@@ -0,0 +1,260 @@
+#include "txeo/detail/Reduction.h"
+#include "txeo/detail/Simd.h"
+#include "txeo/detail/ThreadPool.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace txeo::detail {
+
+namespace {
+
+// Independent accumulators of a contiguous reduction, which the compiler maps to vector lanes
+constexpr size_t lanes{8};
+
+// Minimum number of input elements worth handing to another thread. Full reductions are split in
+// chunks of this size whatever the number of threads, so their results do not depend on it
+constexpr size_t parallel_grain_size{size_t{1} << 15};
+
+template <ReduceOp op, typename T>
+constexpr T identity() {
+  if constexpr (op == ReduceOp::PROD || op == ReduceOp::ALL)
+    return T{1};
+  else if constexpr (op == ReduceOp::MAX)
+    return std::numeric_limits<T>::lowest();
+  else if constexpr (op == ReduceOp::MIN)
+    return std::numeric_limits<T>::max();
+  else
+    return T{0};
+}
+
+// Folds an input element into an accumulator
+template <ReduceOp op, typename T>
+inline T combine(T acc, T value) {
+  if constexpr (op == ReduceOp::SUM)
+    return static_cast<T>(acc + value);
+  else if constexpr (op == ReduceOp::PROD)
+    return static_cast<T>(acc * value);
+  else if constexpr (op == ReduceOp::MAX)
+    return value > acc ? value : acc;
+  else if constexpr (op == ReduceOp::MIN)
+    return value < acc ? value : acc;
+  else if constexpr (op == ReduceOp::SUM_SQUARES)
+    return static_cast<T>(acc + value * value);
+  else if constexpr (op == ReduceOp::ALL)
+    return static_cast<T>(acc && value);
+  else
+    return static_cast<T>(acc || value);
+}
+
+// Folds two partial results; partial sums of squares are merged as plain sums
+template <ReduceOp op, typename T>
+inline T merge(T left, T right) {
+  if constexpr (op == ReduceOp::SUM_SQUARES)
+    return static_cast<T>(left + right);
+  else
+    return combine<op>(left, right);
+}
+
+template <ReduceOp op, typename T>
+inline T reduce_contiguous(const T *TXEO_RESTRICT in, size_t size) {
+  T acc[lanes];
+  for (auto &item : acc)
+    item = identity<op, T>();
+
+  size_t i{0};
+  for (; i + lanes <= size; i += lanes)
+    for (size_t l{0}; l < lanes; ++l)
+      acc[l] = combine<op>(acc[l], in[i + l]);
+
+  T resp = identity<op, T>();
+  for (const auto &item : acc)
+    resp = merge<op>(resp, item);
+  for (; i < size; ++i)
+    resp = combine<op>(resp, in[i]);
+
+  return resp;
+}
+
+// Axes of the input after dropping unit dimensions and folding runs of kept or reduced axes. The
+// innermost run is handled by the contiguous loops; the outer kept and reduced runs are addressed
+// by their input strides
+struct Layout {
+    std::vector<size_t> kept_dims;
+    std::vector<size_t> kept_strides;
+    std::vector<size_t> reduced_dims;
+    std::vector<size_t> reduced_strides;
+    size_t n_kept{1};
+    size_t n_reduced{1};
+    size_t inner{1};
+    bool inner_reduced{false};
+
+    Layout(const std::vector<size_t> &dims, const std::vector<bool> &reduced) {
+      std::vector<size_t> run_dims;
+      std::vector<bool> run_reduced;
+      for (size_t i{0}; i < dims.size(); ++i) {
+        if (dims[i] == 1)
+          continue;
+        if (!run_dims.empty() && run_reduced.back() == reduced[i])
+          run_dims.back() *= dims[i];
+        else {
+          run_dims.emplace_back(dims[i]);
+          run_reduced.emplace_back(reduced[i]);
+        }
+      }
+      if (run_dims.empty())
+        return;
+
+      inner = run_dims.back();
+      inner_reduced = run_reduced.back();
+      size_t stride{inner};
+      for (size_t i{run_dims.size() - 1}; i > 0; --i) {
+        auto &run_dims_out = run_reduced[i - 1] ? reduced_dims : kept_dims;
+        auto &run_strides_out = run_reduced[i - 1] ? reduced_strides : kept_strides;
+        run_dims_out.insert(run_dims_out.begin(), run_dims[i - 1]);
+        run_strides_out.insert(run_strides_out.begin(), stride);
+        stride *= run_dims[i - 1];
+      }
+      for (auto &item : kept_dims)
+        n_kept *= item;
+      for (auto &item : reduced_dims)
+        n_reduced *= item;
+    }
+};
+
+inline size_t input_offset(size_t index, const std::vector<size_t> &dims,
+                           const std::vector<size_t> &strides) {
+  size_t resp{0};
+  for (size_t i{dims.size()}; i > 0; --i) {
+    resp += (index % dims[i - 1]) * strides[i - 1];
+    index /= dims[i - 1];
+  }
+
+  return resp;
+}
+
+// Computes the output elements of the kept outer positions [j0, j1), restricted to the inner
+// columns [c0, c1) when the inner run is kept
+template <ReduceOp op, typename T>
+TXEO_SIMD_CLONES void reduce_block(const Layout &layout, const T *in, T *out, size_t j0, size_t j1,
+                                   size_t c0, size_t c1) {
+  for (size_t j{j0}; j < j1; ++j) {
+    auto base = input_offset(j, layout.kept_dims, layout.kept_strides);
+    if (layout.inner_reduced) {
+      T acc = identity<op, T>();
+      for (size_t r{0}; r < layout.n_reduced; ++r) {
+        const T *row = in + base + input_offset(r, layout.reduced_dims, layout.reduced_strides);
+        acc = merge<op>(acc, reduce_contiguous<op>(row, layout.inner));
+      }
+      out[j] = acc;
+    } else {
+      T *TXEO_RESTRICT block = out + j * layout.inner;
+      for (size_t c{c0}; c < c1; ++c)
+        block[c] = identity<op, T>();
+      for (size_t r{0}; r < layout.n_reduced; ++r) {
+        const T *TXEO_RESTRICT row =
+            in + base + input_offset(r, layout.reduced_dims, layout.reduced_strides);
+        for (size_t c{c0}; c < c1; ++c)
+          block[c] = combine<op>(block[c], row[c]);
+      }
+    }
+  }
+}
+
+template <ReduceOp op, typename T>
+TXEO_SIMD_CLONES T reduce_chunk(const T *in, size_t size) {
+  return reduce_contiguous<op>(in, size);
+}
+
+template <ReduceOp op, typename T>
+void reduce_with(const T *in, const std::vector<size_t> &dims, const std::vector<bool> &reduced,
+                 T *out) {
+  Layout layout{dims, reduced};
+  auto row_size = layout.n_reduced * layout.inner;
+  auto size = layout.n_kept * row_size;
+  auto &pool = ThreadPool::instance();
+
+  if (size <= parallel_grain_size) {
+    reduce_block<op>(layout, in, out, 0, layout.n_kept, 0, layout.inner);
+    return;
+  }
+
+  if (layout.n_kept > 1) {
+    auto grain = std::max<size_t>(parallel_grain_size / row_size, 1);
+    pool.parallel_for(layout.n_kept, grain, [&](size_t begin, size_t end) {
+      reduce_block<op>(layout, in, out, begin, end, 0, layout.inner);
+    });
+  } else if (!layout.inner_reduced) {
+    auto grain = std::max<size_t>(parallel_grain_size / layout.n_reduced, lanes);
+    pool.parallel_for(layout.inner, grain, [&](size_t begin, size_t end) {
+      reduce_block<op>(layout, in, out, 0, 1, begin, end);
+    });
+  } else {
+    // With no kept run left the input is a single reduced run, that is, a contiguous buffer. The
+    // partials are not a vector, whose bool specialization would pack them into shared words
+    auto n_chunks = (size + parallel_grain_size - 1) / parallel_grain_size;
+    auto partials = std::make_unique<T[]>(n_chunks);
+    pool.parallel_for(n_chunks, 1, [&](size_t begin, size_t end) {
+      for (size_t c{begin}; c < end; ++c) {
+        auto offset = c * parallel_grain_size;
+        partials[c] = reduce_chunk<op>(in + offset, std::min(parallel_grain_size, size - offset));
+      }
+    });
+    T acc = identity<op, T>();
+    for (size_t c{0}; c < n_chunks; ++c)
+      acc = merge<op>(acc, partials[c]);
+    out[0] = acc;
+  }
+}
+
+} // namespace
+
+template <typename T>
+void reduce(ReduceOp op, const T *in, const std::vector<size_t> &dims,
+            const std::vector<bool> &reduced, T *out) {
+  switch (op) {
+  case ReduceOp::SUM:
+    reduce_with<ReduceOp::SUM>(in, dims, reduced, out);
+    break;
+  case ReduceOp::PROD:
+    reduce_with<ReduceOp::PROD>(in, dims, reduced, out);
+    break;
+  case ReduceOp::MAX:
+    reduce_with<ReduceOp::MAX>(in, dims, reduced, out);
+    break;
+  case ReduceOp::MIN:
+    reduce_with<ReduceOp::MIN>(in, dims, reduced, out);
+    break;
+  case ReduceOp::SUM_SQUARES:
+    reduce_with<ReduceOp::SUM_SQUARES>(in, dims, reduced, out);
+    break;
+  case ReduceOp::ALL:
+    reduce_with<ReduceOp::ALL>(in, dims, reduced, out);
+    break;
+  case ReduceOp::ANY:
+    reduce_with<ReduceOp::ANY>(in, dims, reduced, out);
+    break;
+  }
+}
+
+template void reduce<size_t>(ReduceOp, const size_t *, const std::vector<size_t> &,
+                             const std::vector<bool> &, size_t *);
+template void reduce<short>(ReduceOp, const short *, const std::vector<size_t> &,
+                            const std::vector<bool> &, short *);
+template void reduce<int>(ReduceOp, const int *, const std::vector<size_t> &,
+                          const std::vector<bool> &, int *);
+template void reduce<bool>(ReduceOp, const bool *, const std::vector<size_t> &,
+                           const std::vector<bool> &, bool *);
+template void reduce<long>(ReduceOp, const long *, const std::vector<size_t> &,
+                           const std::vector<bool> &, long *);
+template void reduce<long long>(ReduceOp, const long long *, const std::vector<size_t> &,
+                                const std::vector<bool> &, long long *);
+template void reduce<float>(ReduceOp, const float *, const std::vector<size_t> &,
+                            const std::vector<bool> &, float *);
+template void reduce<double>(ReduceOp, const double *, const std::vector<size_t> &,
+                             const std::vector<bool> &, double *);
+
+} // namespace txeo::detail
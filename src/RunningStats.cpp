@@ -0,0 +1,149 @@
+#include "txeo/RunningStats.h"
+#include "txeo/detail/ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace txeo {
+
+namespace {
+
+// Elements whose moments are computed from cached values before being folded in
+constexpr size_t block_size{256};
+
+// Elements accumulated by each task when a buffer is split across threads
+constexpr size_t parallel_chunk_size{size_t{1} << 16};
+
+} // namespace
+
+template <typename T>
+void RunningStats<T>::fold(size_t count, double sum, double m2, const T &min, const T &max) {
+  if (count == 0)
+    return;
+
+  auto mean = sum / static_cast<double>(count);
+  _sum += sum;
+  if (_count == 0) {
+    _count = count;
+    _mean = mean;
+    _m2 = m2;
+    _min = min;
+    _max = max;
+    return;
+  }
+
+  auto total = _count + count;
+  auto delta = mean - _mean;
+  auto weight = static_cast<double>(count) / static_cast<double>(total);
+  _mean += delta * weight;
+  _m2 += m2 + delta * delta * static_cast<double>(_count) * weight;
+  _count = total;
+  _min = std::min(_min, min);
+  _max = std::max(_max, max);
+}
+
+template <typename T>
+void RunningStats<T>::push(const T &value) {
+  this->fold(1, static_cast<double>(value), 0.0, value, value);
+}
+
+template <typename T>
+void RunningStats<T>::push(const T *data, size_t size, size_t stride) {
+  if (size > parallel_chunk_size) {
+    auto n_chunks = (size + parallel_chunk_size - 1) / parallel_chunk_size;
+    auto chunks = std::make_unique<RunningStats[]>(n_chunks);
+    detail::ThreadPool::instance().parallel_for(n_chunks, 1, [&](size_t begin, size_t end) {
+      for (size_t c{begin}; c < end; ++c) {
+        auto first = c * parallel_chunk_size;
+        chunks[c].push(data + first * stride, std::min(parallel_chunk_size, size - first), stride);
+      }
+    });
+    for (size_t c{0}; c < n_chunks; ++c)
+      this->merge(chunks[c]);
+    return;
+  }
+
+  double values[block_size];
+  for (size_t b{0}; b < size; b += block_size) {
+    auto n = std::min(block_size, size - b);
+    const auto *block = data + b * stride;
+    T min = block[0];
+    T max = block[0];
+    double sum{0.0};
+    for (size_t i{0}; i < n; ++i) {
+      const auto &value = block[i * stride];
+      min = std::min(min, value);
+      max = std::max(max, value);
+      values[i] = static_cast<double>(value);
+      sum += values[i];
+    }
+
+    auto mean = sum / static_cast<double>(n);
+    double m2{0.0};
+    for (size_t i{0}; i < n; ++i) {
+      auto dif = values[i] - mean;
+      m2 += dif * dif;
+    }
+    this->fold(n, sum, m2, min, max);
+  }
+}
+
+template <typename T>
+void RunningStats<T>::push(const std::vector<T> &values) {
+  // The bool specialization of vector packs its elements, so they are pushed one by one
+  if constexpr (std::is_same_v<T, bool>)
+    for (bool item : values)
+      this->push(item);
+  else
+    this->push(values.data(), values.size());
+}
+
+template <typename T>
+void RunningStats<T>::merge(const RunningStats &other) {
+  this->fold(other._count, other._sum, other._m2, other._min, other._max);
+}
+
+template <typename T>
+T RunningStats<T>::sum() const {
+  return static_cast<T>(_sum);
+}
+
+template <typename T>
+T RunningStats<T>::mean() const {
+  return static_cast<T>(_mean);
+}
+
+template <typename T>
+T RunningStats<T>::variance() const {
+  return _count < 2 ? T{0} : static_cast<T>(_m2 / static_cast<double>(_count - 1));
+}
+
+template <typename T>
+T RunningStats<T>::population_variance() const {
+  return _count == 0 ? T{0} : static_cast<T>(_m2 / static_cast<double>(_count));
+}
+
+template <typename T>
+T RunningStats<T>::standard_deviation() const {
+  return _count < 2 ? T{0} : static_cast<T>(std::sqrt(_m2 / static_cast<double>(_count - 1)));
+}
+
+template <typename T>
+T RunningStats<T>::population_standard_deviation() const {
+  return _count == 0 ? T{0} : static_cast<T>(std::sqrt(_m2 / static_cast<double>(_count)));
+}
+
+template class RunningStats<short>;
+template class RunningStats<int>;
+template class RunningStats<bool>;
+template class RunningStats<long>;
+template class RunningStats<long long>;
+template class RunningStats<float>;
+template class RunningStats<double>;
+template class RunningStats<size_t>;
+
+} // namespace txeo
@@ -3,6 +3,7 @@
 #include "txeo/TensorOp.h"
 #include "txeo/TensorPart.h"
 #include "txeo/TensorShape.h"
+#include "txeo/detail/TensorAllocatorPrivate.h"
 #include "txeo/detail/TensorPrivate.h"
 #include "txeo/detail/TensorShapePrivate.h"
 #include "txeo/detail/utils.h"
@@ -37,11 +38,16 @@ template <typename T>
 template <typename P>
 void Tensor<T>::create_from_shape(P &&shape) {
   auto aux = std::forward<P>(shape);
-  auto shp = aux._impl->tf_shape != nullptr ? *aux._impl->tf_shape : *aux._impl->ext_tf_shape;
-  _impl->tf_tensor = std::make_unique<tf::Tensor>(detail::get_tf_dtype<T>(), shp);
+  const auto &shp =
+      aux._impl->tf_shape != nullptr ? *aux._impl->tf_shape : *aux._impl->ext_tf_shape;
+  // Buffers come from the allocator of the innermost AllocatorScope, if any
+  auto *allocator = detail::AllocatorAdapter::current();
+  _impl->tf_tensor = allocator != nullptr
+                         ? std::make_unique<tf::Tensor>(allocator, detail::get_tf_dtype<T>(), shp)
+                         : std::make_unique<tf::Tensor>(detail::get_tf_dtype<T>(), shp);
   _impl->txeo_shape._impl->tf_shape = nullptr;
   _impl->txeo_shape._impl->ext_tf_shape = &_impl->tf_tensor->shape();
-  _impl->txeo_shape._impl->stride = detail::calc_stride(*_impl->txeo_shape._impl->ext_tf_shape);
+  _impl->txeo_shape._impl->stride = std::move(aux._impl->stride);
 }
 
 template <typename T>
@@ -50,11 +56,35 @@ Tensor<T>::Tensor() : _impl{std::make_unique<Impl>()} {
   this->data()[0] = 0;
 }
 
+template <typename T>
+void Tensor<T>::share_from(const Tensor<T> &tensor) {
+  if (_impl->tf_tensor == nullptr)
+    _impl->tf_tensor = std::make_unique<tf::Tensor>(*tensor._impl->tf_tensor);
+  else
+    *_impl->tf_tensor = *tensor._impl->tf_tensor;
+  _impl->txeo_shape._impl->tf_shape = nullptr;
+  _impl->txeo_shape._impl->ext_tf_shape = &_impl->tf_tensor->shape();
+  _impl->txeo_shape._impl->stride = tensor._impl->txeo_shape._impl->stride;
+}
+
+// The TF buffer is reference counted, so a buffer referenced by a single tensor can be written in
+// place. Otherwise this tensor gets its own copy, leaving the other owners untouched
+template <typename T>
+void Tensor<T>::detach() {
+  auto &tf_tensor = *_impl->tf_tensor;
+  if (tf_tensor.NumElements() == 0 || tf_tensor.RefCountIsOne())
+    return;
+  auto *allocator = detail::AllocatorAdapter::current();
+  auto aux = allocator != nullptr ? tf::Tensor(allocator, tf_tensor.dtype(), tf_tensor.shape())
+                                  : tf::Tensor(tf_tensor.dtype(), tf_tensor.shape());
+  std::copy_n(static_cast<const T *>(tf_tensor.data()), tf_tensor.NumElements(),
+              static_cast<T *>(aux.data()));
+  tf_tensor = std::move(aux);
+}
+
 template <typename T>
 Tensor<T>::Tensor(const Tensor &tensor) : _impl{std::make_unique<Impl>()} {
-  create_from_shape(tensor.shape().clone());
-  for (size_t i{0}; i < this->dim(); ++i)
-    this->data()[i] = tensor.data()[i];
+  this->share_from(tensor);
 }
 
 template <typename T>
@@ -134,9 +164,8 @@ Tensor<T>::Tensor(
 
 template <typename T>
 Tensor<T> &Tensor<T>::operator=(const Tensor &tensor) {
-  this->create_from_shape(tensor.shape().clone());
-  for (size_t i{0}; i < this->dim(); ++i)
-    this->data()[i] = tensor.data()[i];
+  if (this != &tensor)
+    this->share_from(tensor);
 
   return *this;
 }
@@ -154,8 +183,10 @@ template <typename T>
 bool Tensor<T>::operator==(const Tensor &tensor) {
   if (_impl->tf_tensor->shape() != tensor._impl->tf_tensor->shape())
     return false;
+  const auto *left = std::as_const(*this).data();
+  const auto *right = tensor.data();
   for (size_t i{0}; i < this->dim(); ++i) {
-    if (!detail::is_zero(this->data()[i] - tensor.data()[i]))
+    if (!detail::is_zero(left[i] - right[i]))
       return false;
   }
 
@@ -166,8 +197,10 @@ template <typename T>
 bool Tensor<T>::operator!=(const Tensor &tensor) {
   if (_impl->tf_tensor->shape() != tensor._impl->tf_tensor->shape())
     return true;
+  const auto *left = std::as_const(*this).data();
+  const auto *right = tensor.data();
   for (size_t i{0}; i < this->dim(); ++i) {
-    if (this->data()[i] != tensor.data()[i])
+    if (left[i] != right[i])
       return true;
   }
 
@@ -268,8 +301,8 @@ Tensor<T> Tensor<T>::flatten() const {
 
 template <typename T>
 void Tensor<T>::fill(const T &value) {
-  for (size_t i{0}; i < this->dim(); ++i)
-    this->data()[i] = value;
+  auto *data = this->data();
+  std::fill_n(data, this->dim(), value);
 }
 
 template <typename T>
@@ -281,6 +314,7 @@ Tensor<T> &Tensor<T>::operator=(const T &value) {
 
 template <typename T>
 T *Tensor<T>::data() {
+  this->detach();
   return static_cast<T *>(_impl->tf_tensor->data());
 }
 
@@ -380,8 +414,9 @@ void Tensor<T>::fill_with_uniform_random(const T &min, const T &max, const size_
   engine.seed(sseq);
 
   std::uniform_real_distribution<double> scaler{aux_min, aux_max};
+  auto *data = this->data();
   for (size_t i{0}; i < this->dim(); ++i)
-    this->data()[i] = static_cast<T>(scaler(engine));
+    data[i] = static_cast<T>(scaler(engine));
 }
 
 template <typename T>
@@ -397,8 +432,9 @@ void Tensor<T>::fill_with_uniform_random(const T &min, const T &max) {
   std::mt19937 engine{std::random_device{}()};
 
   std::uniform_real_distribution<double> scaler{aux_min, aux_max};
+  auto *data = this->data();
   for (size_t i{0}; i < this->dim(); ++i)
-    this->data()[i] = static_cast<T>(scaler(engine));
+    data[i] = static_cast<T>(scaler(engine));
 }
 
 template <typename U>
@@ -6,16 +6,23 @@
 #include <cstdint>
 #include <cstdlib>
 #include <iterator>
+#include <limits>
 #include <memory>
-#include <queue>
+#include <numeric>
 #include <stdexcept>
 #include <string>
 #include <tensorflow/cc/framework/ops.h>
 #include <tensorflow/cc/ops/math_ops.h>
+#include <type_traits>
 
+#include "txeo/QuantileSketch.h"
+#include "txeo/RunningStats.h"
 #include "txeo/Tensor.h"
 #include "txeo/TensorFunc.h"
+#include "txeo/TensorView.h"
+#include "txeo/detail/Reduction.h"
 #include "txeo/detail/TensorHelper.h"
+#include "txeo/detail/ThreadPool.h"
 #include "txeo/detail/utils.h"
 
 namespace tensorflow {
@@ -26,122 +33,266 @@ namespace txeo {
 
 namespace tf = tensorflow;
 
+namespace {
+
+// Minimum number of elements worth handing to another thread when reducing fibers
+constexpr size_t fiber_grain_size{size_t{1} << 14};
+
+// Elements of a fiber summarized by one sketch when a fiber is split across threads
+constexpr size_t sketch_segment_size{size_t{1} << 16};
+
+// Elements of a fiber described by one task; the partial statistics of segments are merged
+constexpr size_t describe_segment_size{size_t{1} << 16};
+
+// Elements of each fiber and number of fibers scanned together by describe. A tile of
+// describe_tile_rows x describe_tile_columns elements stays in cache between fibers
+constexpr size_t describe_tile_rows{256};
+constexpr size_t describe_tile_columns{64};
+
+// Sums the elements of a view into the positions of the kept axes. Elements are visited in
+// row-major order, so the output offset is advanced like an odometer instead of being recomputed
 template <typename T>
-void TensorAgg<T>::verify_parameters(const Tensor<T> &tensor, const std::vector<size_t> &axes) {
-  if (tensor.dim() == 0)
+Tensor<T> sum_view(const TensorView<T> &view, const std::vector<size_t> &axes) {
+  if (view.dim() == 0)
     throw TensorAggError("Tensor has dimension zero.");
 
-  for (auto &item : axes)
-    if (item >= detail::to_size_t(tensor.order()))
+  auto order = view.order();
+  std::vector<bool> reduced(order, false);
+  for (auto &item : axes) {
+    if (item >= order)
       throw TensorAggError("Inconsistent axes.");
+    reduced[item] = true;
+  }
+
+  auto dims = detail::to_size_t(view.shape().axes_dims());
+  std::vector<size_t> out_dims;
+  for (size_t i{0}; i < order; ++i)
+    if (!reduced[i])
+      out_dims.emplace_back(dims[i]);
+
+  std::vector<size_t> out_stride(order, 0);
+  size_t acc{1};
+  for (size_t i{order}; i > 0; --i) {
+    if (!reduced[i - 1]) {
+      out_stride[i - 1] = acc;
+      acc *= dims[i - 1];
+    }
+  }
+
+  Tensor<T> resp(TensorShape(out_dims), T{0});
+  auto *resp_data = resp.data();
+  std::vector<size_t> index(order, 0);
+  size_t offset{0};
+  view.for_each([&](size_t, const T &value) {
+    resp_data[offset] += value;
+    for (size_t i{order}; i > 0; --i) {
+      offset += out_stride[i - 1];
+      if (++index[i - 1] < dims[i - 1])
+        break;
+      offset -= out_stride[i - 1] * dims[i - 1];
+      index[i - 1] = 0;
+    }
+  });
+
+  return resp;
 }
 
+// Reduces a tensor along the axes with the native kernel
 template <typename T>
-Tensor<T> TensorAgg<T>::accumulate(const Tensor<T> &tensor, size_t axis,
-                                   std::function<T(std::vector<T> &)> acc_fun) {
+Tensor<T> reduce_native(const Tensor<T> &tensor, const std::vector<size_t> &axes,
+                        detail::ReduceOp op) {
+  auto dims = detail::to_size_t(tensor.shape().axes_dims());
+  std::vector<bool> reduced(dims.size(), false);
+  for (auto &item : axes)
+    reduced[item] = true;
+
+  std::vector<size_t> out_dims;
+  for (size_t i{0}; i < dims.size(); ++i)
+    if (!reduced[i])
+      out_dims.emplace_back(dims[i]);
+
+  Tensor<T> resp(TensorShape(out_dims), T{0});
+  detail::reduce(op, tensor.data(), dims, reduced, resp.data());
+
+  return resp;
+}
 
+// Fibers of a tensor along an axis. Fiber f starts at offset(f) and its elements are inner
+// positions apart; the dimensions of the other axes, in order, give the shape of the results
+struct Fibers {
+    size_t outer{1};
+    size_t length{1};
+    size_t inner{1};
+    std::vector<size_t> shape;
+
+    [[nodiscard]] size_t count() const { return outer * inner; }
+    [[nodiscard]] size_t offset(size_t f) const { return (f / inner) * length * inner + f % inner; }
+};
+
+template <typename T>
+Fibers fibers_along(const Tensor<T> &tensor, size_t axis) {
   if (tensor.dim() == 0)
     throw TensorAggError("Tensor has dimension zero.");
 
-  if (axis >= detail::to_size_t(tensor.order()))
+  auto dims = detail::to_size_t(tensor.shape().axes_dims());
+  if (axis >= dims.size())
     throw TensorAggError("Inconsistent axis.");
 
-  int64_t accum_step = 1;
-  for (size_t i{axis + 1}; i < detail::to_size_t(tensor.order()); ++i)
-    accum_step *= tensor.shape().axis_dim(i);
-  auto axis_dim = detail::to_size_t(tensor.shape().axis_dim(axis));
-
-  size_t p{0}, s{0};
-  auto data = tensor.data();
-  std::priority_queue<size_t, std::vector<size_t>, std::greater<>> accum_indexes;
-  std::vector<T> values;
-  std::vector<T> vec_resp;
-
-  while (p < tensor.dim()) {
-    s = p;
-    values.emplace_back(data[p]);
-    for (size_t i{0}; i < axis_dim - 1; ++i) {
-      s += accum_step;
-      accum_indexes.emplace(s);
-      values.emplace_back(data[s]);
-    }
-    vec_resp.emplace_back(acc_fun(values));
-    values.clear();
-    ++p;
-    while (!accum_indexes.empty() && p == accum_indexes.top()) {
-      accum_indexes.pop();
-      ++p;
-    }
+  Fibers resp;
+  for (size_t i{0}; i < dims.size(); ++i) {
+    if (i < axis)
+      resp.outer *= dims[i];
+    else if (i > axis)
+      resp.inner *= dims[i];
+    if (i != axis)
+      resp.shape.emplace_back(dims[i]);
   }
+  resp.length = dims[axis];
 
-  auto dims = tensor.shape().axes_dims();
-  std::vector<size_t> shape_resp;
+  return resp;
+}
 
-  for (size_t i{0}; i < detail::to_size_t(tensor.order()); ++i)
-    if (i != axis)
-      shape_resp.emplace_back(dims[i]);
+// Runs chunks [begin, end) of the fibers across the shared thread pool
+template <typename F>
+void parallel_fibers(const Fibers &fibers, F chunk) {
+  auto grain = std::max<size_t>(fiber_grain_size / fibers.length, 1);
+  detail::ThreadPool::instance().parallel_for(fibers.count(), grain, chunk);
+}
 
-  Tensor<T> resp(shape_resp, vec_resp);
+template <typename T>
+void gather_fiber(const T *data, const Fibers &fibers, size_t f, std::vector<T> &values) {
+  const auto *first = data + fibers.offset(f);
+  values.resize(fibers.length);
+  for (size_t k{0}; k < fibers.length; ++k)
+    values[k] = first[k * fibers.inner];
+}
+
+// Maps every fiber of the tensor along the axis to an output element. Each fiber is gathered into
+// a scratch buffer that a thread reuses across its chunk of fibers
+template <typename T, typename R, typename F>
+Tensor<R> reduce_fibers(const Tensor<T> &tensor, size_t axis, F func) {
+  auto fibers = fibers_along(tensor, axis);
+  Tensor<R> resp(TensorShape(fibers.shape), R{0});
+  const auto *data = tensor.data();
+  auto *resp_data = resp.data();
+  parallel_fibers(fibers, [&](size_t begin, size_t end) {
+    std::vector<T> values;
+    for (size_t f{begin}; f < end; ++f) {
+      gather_fiber(data, fibers, f, values);
+      resp_data[f] = static_cast<R>(func(values));
+    }
+  });
 
   return resp;
 }
 
+void verify_quantiles(const std::vector<double> &quantiles) {
+  if (quantiles.empty())
+    throw TensorAggError("Quantiles can not be empty.");
+  for (auto &q : quantiles)
+    if (!(q >= 0.0 && q <= 1.0))
+      throw TensorAggError("Quantiles must lie in [0, 1].");
+}
+
+// Writes linearly interpolated quantiles of the values. The ranks are selected in ascending
+// order, each selection partitioning only the values above the ranks already in place
 template <typename T>
-Tensor<size_t> TensorAgg<T>::count(const Tensor<T> &tensor, size_t axis,
-                                   std::function<size_t(std::vector<T> &)> count_fun) {
+void select_quantiles(std::vector<T> &values, const std::vector<double> &quantiles,
+                      const std::vector<size_t> &order, T *out) {
+  auto n = values.size();
+  size_t placed{0};
+  auto place = [&](size_t rank) {
+    if (rank < placed)
+      return;
+    std::nth_element(values.begin() + static_cast<std::ptrdiff_t>(placed),
+                     values.begin() + static_cast<std::ptrdiff_t>(rank), values.end());
+    placed = rank + 1;
+  };
+
+  for (auto &i : order) {
+    auto position = quantiles[i] * static_cast<double>(n - 1);
+    auto low = static_cast<size_t>(std::floor(position));
+    auto fraction = position - static_cast<double>(low);
+    place(low);
+    double value = static_cast<double>(values[low]);
+    if (fraction > 0.0 && low + 1 < n) {
+      place(low + 1);
+      value += fraction * (static_cast<double>(values[low + 1]) - value);
+    }
+    out[i] = static_cast<T>(value);
+  }
+}
 
-  if (tensor.dim() == 0)
-    throw TensorAggError("Tensor has dimension zero.");
+// Statistics of a fiber segment gathered by describe
+template <typename T>
+struct FiberSummary {
+    RunningStats<T> stats;
+    size_t non_zero{0};
+    size_t nan{0};
+
+    void merge(const FiberSummary &other) {
+      stats.merge(other.stats);
+      non_zero += other.non_zero;
+      nan += other.nan;
+    }
+};
 
-  if (axis >= detail::to_size_t(tensor.order()))
-    throw TensorAggError("Inconsistent axis.");
+// Adds strided elements to a summary. NaN elements are only counted, so blocks without them go
+// to the running statistics as a whole
+template <typename T>
+void summarize(const T *first, size_t size, size_t stride, FiberSummary<T> &summary) {
+  size_t non_zero{0};
+  size_t nan{0};
+  for (size_t i{0}; i < size; ++i) {
+    const auto &value = first[i * stride];
+    non_zero += detail::is_zero(value) ? 0 : 1;
+    if constexpr (std::is_floating_point_v<T>)
+      nan += std::isnan(value) ? 1 : 0;
+  }
+  summary.non_zero += non_zero;
+  summary.nan += nan;
 
-  int64_t accum_step = 1;
-  for (size_t i{axis + 1}; i < detail::to_size_t(tensor.order()); ++i)
-    accum_step *= tensor.shape().axis_dim(i);
-  auto axis_dim = detail::to_size_t(tensor.shape().axis_dim(axis));
-
-  size_t p{0}, s{0};
-  auto data = tensor.data();
-  std::priority_queue<size_t, std::vector<size_t>, std::greater<>> accum_indexes;
-  std::vector<T> values;
-  std::vector<size_t> vec_resp;
-
-  while (p < tensor.dim()) {
-    s = p;
-    values.emplace_back(data[p]);
-    for (size_t i{0}; i < axis_dim - 1; ++i) {
-      s += accum_step;
-      accum_indexes.emplace(s);
-      values.emplace_back(data[s]);
-    }
-    vec_resp.emplace_back(count_fun(values));
-    values.clear();
-    ++p;
-    while (!accum_indexes.empty() && p == accum_indexes.top()) {
-      accum_indexes.pop();
-      ++p;
-    }
+  if (nan == 0) {
+    summary.stats.push(first, size, stride);
+    return;
   }
+  for (size_t i{0}; i < size; ++i)
+    if (!std::isnan(first[i * stride]))
+      summary.stats.push(first[i * stride]);
+}
 
-  auto dims = tensor.shape().axes_dims();
-  std::vector<size_t> shape_resp;
+} // namespace
 
-  for (size_t i{0}; i < detail::to_size_t(tensor.order()); ++i)
-    if (i != axis)
-      shape_resp.emplace_back(dims[i]);
+template <typename T>
+void TensorAgg<T>::verify_parameters(const Tensor<T> &tensor, const std::vector<size_t> &axes) {
+  if (tensor.dim() == 0)
+    throw TensorAggError("Tensor has dimension zero.");
 
-  Tensor<size_t> resp(shape_resp, vec_resp);
+  for (auto &item : axes)
+    if (item >= detail::to_size_t(tensor.order()))
+      throw TensorAggError("Inconsistent axes.");
+}
 
-  return resp;
+template <typename T>
+template <typename F>
+Tensor<T> TensorAgg<T>::accumulate(const Tensor<T> &tensor, size_t axis, F acc_fun) {
+  return reduce_fibers<T, T>(tensor, axis, acc_fun);
+}
+
+template <typename T>
+template <typename F>
+Tensor<size_t> TensorAgg<T>::count(const Tensor<T> &tensor, size_t axis, F count_fun) {
+  return reduce_fibers<T, size_t>(tensor, axis, count_fun);
 }
 
 template <typename T>
 Tensor<T> TensorAgg<T>::reduce_sum(const Tensor<T> &tensor, const std::vector<size_t> &axes) {
   TensorAgg<T>::verify_parameters(tensor, axes);
+  if (detail::use_native_reduce<T>(detail::ReduceOp::SUM, tensor.dim()))
+    return reduce_native(tensor, axes, detail::ReduceOp::SUM);
   try {
     auto resp = detail::TensorHelper::reduce_tensor<T>(
-        *tensor._impl->tf_tensor, axes,
+        *tensor._impl->tf_tensor, axes, "ReduceSum",
         [](const tf::Scope &scope, tf::Input input, tf::Input axis) -> tf::Output {
           return tf::ops::ReduceSum(scope, input, axis);
         });
@@ -151,12 +302,19 @@ Tensor<T> TensorAgg<T>::reduce_sum(const Tensor<T> &tensor, const std::vector<si
   }
 }
 
+template <typename T>
+Tensor<T> TensorAgg<T>::reduce_sum(const TensorView<T> &view, const std::vector<size_t> &axes) {
+  return sum_view(view, axes);
+}
+
 template <typename T>
 Tensor<T> TensorAgg<T>::reduce_prod(const Tensor<T> &tensor, const std::vector<size_t> &axes) {
   TensorAgg<T>::verify_parameters(tensor, axes);
+  if (detail::use_native_reduce<T>(detail::ReduceOp::PROD, tensor.dim()))
+    return reduce_native(tensor, axes, detail::ReduceOp::PROD);
   try {
     auto resp = detail::TensorHelper::reduce_tensor<T>(
-        *tensor._impl->tf_tensor, axes,
+        *tensor._impl->tf_tensor, axes, "ReduceProd",
         [](const tf::Scope &scope, tf::Input input, tf::Input axis) -> tf::Output {
           return tf::ops::ReduceProd(scope, input, axis);
         });
@@ -169,9 +327,17 @@ Tensor<T> TensorAgg<T>::reduce_prod(const Tensor<T> &tensor, const std::vector<s
 template <typename T>
 Tensor<T> TensorAgg<T>::reduce_mean(const Tensor<T> &tensor, const std::vector<size_t> &axes) {
   TensorAgg<T>::verify_parameters(tensor, axes);
+  if (detail::use_native_reduce<T>(detail::ReduceOp::SUM, tensor.dim())) {
+    auto resp = reduce_native(tensor, axes, detail::ReduceOp::SUM);
+    auto count = static_cast<T>(tensor.dim() / resp.dim());
+    auto *resp_data = resp.data();
+    for (size_t i{0}; i < resp.dim(); ++i)
+      resp_data[i] /= count;
+    return resp;
+  }
   try {
     auto resp = detail::TensorHelper::reduce_tensor<T>(
-        *tensor._impl->tf_tensor, axes,
+        *tensor._impl->tf_tensor, axes, "Mean",
         [](const tf::Scope &scope, tf::Input input, tf::Input axis) -> tf::Output {
           return tf::ops::Mean(scope, input, axis);
         });
@@ -181,12 +347,25 @@ Tensor<T> TensorAgg<T>::reduce_mean(const Tensor<T> &tensor, const std::vector<s
   }
 }
 
+template <typename T>
+Tensor<T> TensorAgg<T>::reduce_mean(const TensorView<T> &view, const std::vector<size_t> &axes) {
+  auto resp = sum_view(view, axes);
+  auto count = static_cast<T>(view.dim() / resp.dim());
+  auto *resp_data = resp.data();
+  for (size_t i{0}; i < resp.dim(); ++i)
+    resp_data[i] /= count;
+
+  return resp;
+}
+
 template <typename T>
 Tensor<T> TensorAgg<T>::reduce_max(const Tensor<T> &tensor, const std::vector<size_t> &axes) {
   TensorAgg<T>::verify_parameters(tensor, axes);
+  if (detail::use_native_reduce<T>(detail::ReduceOp::MAX, tensor.dim()))
+    return reduce_native(tensor, axes, detail::ReduceOp::MAX);
   try {
     auto resp = detail::TensorHelper::reduce_tensor<T>(
-        *tensor._impl->tf_tensor, axes,
+        *tensor._impl->tf_tensor, axes, "Max",
         [](const tf::Scope &scope, tf::Input input, tf::Input axis) -> tf::Output {
           return tf::ops::Max(scope, input, axis);
         });
@@ -199,9 +378,11 @@ Tensor<T> TensorAgg<T>::reduce_max(const Tensor<T> &tensor, const std::vector<si
 template <typename T>
 Tensor<T> TensorAgg<T>::reduce_min(const Tensor<T> &tensor, const std::vector<size_t> &axes) {
   TensorAgg<T>::verify_parameters(tensor, axes);
+  if (detail::use_native_reduce<T>(detail::ReduceOp::MIN, tensor.dim()))
+    return reduce_native(tensor, axes, detail::ReduceOp::MIN);
   try {
     auto resp = detail::TensorHelper::reduce_tensor<T>(
-        *tensor._impl->tf_tensor, axes,
+        *tensor._impl->tf_tensor, axes, "Min",
         [](const tf::Scope &scope, tf::Input input, tf::Input axis) -> tf::Output {
           return tf::ops::Min(scope, input, axis);
         });
@@ -215,9 +396,16 @@ template <typename T>
 Tensor<T> TensorAgg<T>::reduce_euclidean_norm(const Tensor<T> &tensor,
                                               const std::vector<size_t> &axes) {
   TensorAgg<T>::verify_parameters(tensor, axes);
+  if (detail::use_native_reduce<T>(detail::ReduceOp::SUM_SQUARES, tensor.dim())) {
+    auto resp = reduce_native(tensor, axes, detail::ReduceOp::SUM_SQUARES);
+    auto *resp_data = resp.data();
+    for (size_t i{0}; i < resp.dim(); ++i)
+      resp_data[i] = static_cast<T>(std::sqrt(static_cast<double>(resp_data[i])));
+    return resp;
+  }
   try {
     auto resp = detail::TensorHelper::reduce_tensor<T>(
-        *tensor._impl->tf_tensor, axes,
+        *tensor._impl->tf_tensor, axes, "EuclideanNorm",
         [](const tf::Scope &scope, tf::Input input, tf::Input axis) -> tf::Output {
           return tf::ops::EuclideanNorm(scope, input, axis);
         });
@@ -243,7 +431,7 @@ Tensor<T> TensorAgg<T>::cumulative_prod(const Tensor<T> &tensor, size_t axis) {
 
   try {
     auto resp = detail::TensorHelper::reduce_tensor<T>(
-        *tensor._impl->tf_tensor, axis,
+        *tensor._impl->tf_tensor, axis, "Cumprod",
         [](const tf::Scope &scope, tf::Input input, tf::Input axis) -> tf::Output {
           return tf::ops::Cumprod(scope, input, axis);
         });
@@ -257,7 +445,7 @@ template <typename T>
 Tensor<T> TensorAgg<T>::cumulative_sum(const Tensor<T> &tensor, size_t axis) {
   try {
     auto resp = detail::TensorHelper::reduce_tensor<T>(
-        *tensor._impl->tf_tensor, axis,
+        *tensor._impl->tf_tensor, axis, "Cumsum",
         [](const tf::Scope &scope, tf::Input input, tf::Input axis) -> tf::Output {
           return tf::ops::Cumsum(scope, input, axis);
         });
@@ -277,7 +465,7 @@ Tensor<size_t> TensorAgg<T>::arg_max(const Tensor<T> &tensor, size_t axis) {
 
   try {
     auto resp = detail::TensorHelper::reduce_tensor_to_indexes<T>(
-        *tensor._impl->tf_tensor, detail::to_int64(axis),
+        *tensor._impl->tf_tensor, detail::to_int64(axis), "ArgMax",
         [](const tf::Scope &scope, tf::Input input, int64_t axis) -> tf::Output {
           return tf::ops::ArgMax(scope, input, axis);
         });
@@ -297,7 +485,7 @@ Tensor<size_t> TensorAgg<T>::arg_min(const Tensor<T> &tensor, size_t axis) {
 
   try {
     auto resp = detail::TensorHelper::reduce_tensor_to_indexes<T>(
-        *tensor._impl->tf_tensor, detail::to_int64(axis),
+        *tensor._impl->tf_tensor, detail::to_int64(axis), "ArgMin",
         [](const tf::Scope &scope, tf::Input input, int64_t axis) -> tf::Output {
           return tf::ops::ArgMin(scope, input, axis);
         });
@@ -315,14 +503,80 @@ Tensor<size_t> TensorAgg<T>::count_non_zero(const Tensor<T> &tensor, size_t axis
   });
 }
 
+template <typename T>
+typename TensorAgg<T>::Description TensorAgg<T>::describe(const Tensor<T> &tensor, size_t axis) {
+  auto fibers = fibers_along(tensor, axis);
+  auto n_segments = (fibers.length + describe_segment_size - 1) / describe_segment_size;
+  auto n_column_blocks = (fibers.inner + describe_tile_columns - 1) / describe_tile_columns;
+  std::vector<FiberSummary<T>> summaries(fibers.count() * n_segments);
+
+  // Fibers sharing an outer index are interleaved in memory, so each task scans a block of them
+  // tile by tile over one segment, reading every cache line once for all its fibers
+  const auto *data = tensor.data();
+  auto n_tasks = fibers.outer * n_column_blocks * n_segments;
+  auto task_size = std::min(fibers.length, describe_segment_size) *
+                   std::min(fibers.inner, describe_tile_columns);
+  auto grain = std::max<size_t>(fiber_grain_size / task_size, 1);
+  detail::ThreadPool::instance().parallel_for(n_tasks, grain, [&](size_t begin, size_t end) {
+    for (size_t t{begin}; t < end; ++t) {
+      auto segment = t % n_segments;
+      auto block = t / n_segments;
+      auto outer = block / n_column_blocks;
+      auto column_begin = (block % n_column_blocks) * describe_tile_columns;
+      auto column_end = std::min(fibers.inner, column_begin + describe_tile_columns);
+      auto row_end = std::min(fibers.length, (segment + 1) * describe_segment_size);
+      for (size_t k{segment * describe_segment_size}; k < row_end; k += describe_tile_rows) {
+        auto rows = std::min(describe_tile_rows, row_end - k);
+        const auto *tile = data + (outer * fibers.length + k) * fibers.inner;
+        for (size_t c{column_begin}; c < column_end; ++c) {
+          auto f = outer * fibers.inner + c;
+          summarize(tile + c, rows, fibers.inner, summaries[f * n_segments + segment]);
+        }
+      }
+    }
+  });
+
+  TensorShape shape(fibers.shape);
+  auto values = [&shape]() { return Tensor<T>(shape, T{0}); };
+  auto counts = [&shape]() { return Tensor<size_t>(shape, size_t{0}); };
+  Description resp{values(), values(), values(), values(), values(), counts(), counts()};
+  for (size_t f{0}; f < fibers.count(); ++f) {
+    auto &summary = summaries[f * n_segments];
+    for (size_t s{1}; s < n_segments; ++s)
+      summary.merge(summaries[f * n_segments + s]);
+    resp.non_zero.data()[f] = summary.non_zero;
+    resp.nan.data()[f] = summary.nan;
+
+    // A fiber made only of NaN has no statistics, which must not look like an all-zero fiber
+    const auto &stats = summary.stats;
+    if constexpr (std::is_floating_point_v<T>) {
+      if (stats.count() == 0) {
+        auto nan = std::numeric_limits<T>::quiet_NaN();
+        resp.min.data()[f] = resp.max.data()[f] = nan;
+        resp.mean.data()[f] = resp.variance.data()[f] = nan;
+        continue;
+      }
+    }
+    resp.min.data()[f] = stats.min();
+    resp.max.data()[f] = stats.max();
+    resp.sum.data()[f] = stats.sum();
+    resp.mean.data()[f] = stats.mean();
+    resp.variance.data()[f] = stats.variance();
+  }
+
+  return resp;
+}
+
 template <typename T>
 Tensor<T> TensorAgg<T>::reduce_all(const Tensor<T> &tensor, const std::vector<size_t> &axes)
   requires(std::convertible_to<T, bool>)
 {
   TensorAgg<T>::verify_parameters(tensor, axes);
+  if (detail::use_native_reduce<T>(detail::ReduceOp::ALL, tensor.dim()))
+    return reduce_native(tensor, axes, detail::ReduceOp::ALL);
   try {
     auto resp = detail::TensorHelper::reduce_tensor<T>(
-        *tensor._impl->tf_tensor, axes,
+        *tensor._impl->tf_tensor, axes, "ReduceAll",
         [](const tf::Scope &scope, tf::Input input, tf::Input axis) -> tf::Output {
           return tf::ops::ReduceAll(scope, input, axis);
         });
@@ -337,9 +591,11 @@ Tensor<T> TensorAgg<T>::reduce_any(const Tensor<T> &tensor, const std::vector<si
   requires(std::convertible_to<T, bool>)
 {
   TensorAgg<T>::verify_parameters(tensor, axes);
+  if (detail::use_native_reduce<T>(detail::ReduceOp::ANY, tensor.dim()))
+    return reduce_native(tensor, axes, detail::ReduceOp::ANY);
   try {
     auto resp = detail::TensorHelper::reduce_tensor<T>(
-        *tensor._impl->tf_tensor, axes,
+        *tensor._impl->tf_tensor, axes, "ReduceAny",
         [](const tf::Scope &scope, tf::Input input, tf::Input axis) -> tf::Output {
           return tf::ops::ReduceAny(scope, input, axis);
         });
@@ -349,10 +605,27 @@ Tensor<T> TensorAgg<T>::reduce_any(const Tensor<T> &tensor, const std::vector<si
   }
 }
 
+// Fibers are streamed into the accumulators by stride, without being gathered
 template <typename T>
 Tensor<T> TensorAgg<T>::reduce_variance(const Tensor<T> &tensor, size_t axis) {
-  return TensorAgg<T>::accumulate(
-      tensor, axis, [](std::vector<T> &values) -> T { return TensorAgg<T>::variance(values); });
+  auto fibers = fibers_along(tensor, axis);
+  Tensor<T> resp(TensorShape(fibers.shape), T{0});
+  const auto *data = tensor.data();
+  auto *resp_data = resp.data();
+  parallel_fibers(fibers, [&](size_t begin, size_t end) {
+    for (size_t f{begin}; f < end; ++f) {
+      const auto *first = data + fibers.offset(f);
+      if (fibers.length == 1) {
+        resp_data[f] = *first;
+        continue;
+      }
+      RunningStats<T> stats;
+      stats.push(first, fibers.length, fibers.inner);
+      resp_data[f] = stats.variance();
+    }
+  });
+
+  return resp;
 }
 
 template <typename T>
@@ -367,6 +640,89 @@ Tensor<T> TensorAgg<T>::reduce_median(const Tensor<T> &tensor, size_t axis) {
       tensor, axis, [](std::vector<T> &values) -> T { return TensorAgg<T>::median(values); });
 }
 
+template <typename T>
+Tensor<T> TensorAgg<T>::reduce_quantiles(const Tensor<T> &tensor, size_t axis,
+                                         const std::vector<double> &quantiles) {
+  verify_quantiles(quantiles);
+  auto fibers = fibers_along(tensor, axis);
+  auto shape = fibers.shape;
+  shape.emplace_back(quantiles.size());
+
+  std::vector<size_t> order(quantiles.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::ranges::sort(order, [&](size_t left, size_t right) {
+    return quantiles[left] < quantiles[right];
+  });
+
+  Tensor<T> resp(TensorShape(shape), T{0});
+  const auto *data = tensor.data();
+  auto *resp_data = resp.data();
+  parallel_fibers(fibers, [&](size_t begin, size_t end) {
+    std::vector<T> values;
+    for (size_t f{begin}; f < end; ++f) {
+      gather_fiber(data, fibers, f, values);
+      select_quantiles(values, quantiles, order, resp_data + f * quantiles.size());
+    }
+  });
+
+  return resp;
+}
+
+template <typename T>
+Tensor<T> TensorAgg<T>::reduce_quantiles_approx(const Tensor<T> &tensor, size_t axis,
+                                                const std::vector<double> &quantiles,
+                                                size_t sketch_capacity) {
+  verify_quantiles(quantiles);
+  auto fibers = fibers_along(tensor, axis);
+  auto shape = fibers.shape;
+  shape.emplace_back(quantiles.size());
+
+  Tensor<T> resp(TensorShape(shape), T{0});
+  const auto *data = tensor.data();
+  auto *resp_data = resp.data();
+  auto write = [&](size_t f, const QuantileSketch<T> &sketch) {
+    auto values = sketch.quantiles(quantiles);
+    std::ranges::copy(values, resp_data + f * quantiles.size());
+  };
+
+  try {
+    auto &pool = detail::ThreadPool::instance();
+    if (fibers.count() >= pool.size()) {
+      parallel_fibers(fibers, [&](size_t begin, size_t end) {
+        for (size_t f{begin}; f < end; ++f) {
+          QuantileSketch<T> sketch{sketch_capacity};
+          const auto *first = data + fibers.offset(f);
+          for (size_t k{0}; k < fibers.length; ++k)
+            sketch.insert(first[k * fibers.inner]);
+          write(f, sketch);
+        }
+      });
+      return resp;
+    }
+
+    // Few long fibers: segments of each fiber are sketched in parallel and merged
+    auto n_segments = (fibers.length + sketch_segment_size - 1) / sketch_segment_size;
+    for (size_t f{0}; f < fibers.count(); ++f) {
+      const auto *first = data + fibers.offset(f);
+      std::vector<QuantileSketch<T>> sketches(n_segments, QuantileSketch<T>{sketch_capacity});
+      pool.parallel_for(n_segments, 1, [&](size_t begin, size_t end) {
+        for (size_t s{begin}; s < end; ++s) {
+          auto stop = std::min(fibers.length, (s + 1) * sketch_segment_size);
+          for (size_t k{s * sketch_segment_size}; k < stop; ++k)
+            sketches[s].insert(first[k * fibers.inner]);
+        }
+      });
+      for (size_t s{1}; s < n_segments; ++s)
+        sketches[0].merge(sketches[s]);
+      write(f, sketches[0]);
+    }
+  } catch (const QuantileSketchError &e) {
+    throw TensorAggError("Quantile error: " + std::string{e.what()});
+  }
+
+  return resp;
+}
+
 template <typename T>
 Tensor<T> TensorAgg<T>::reduce_geometric_mean(const Tensor<T> &tensor, size_t axis) {
   return TensorAgg<T>::accumulate(tensor, axis, [](std::vector<T> &values) -> T {
@@ -375,13 +731,12 @@ Tensor<T> TensorAgg<T>::reduce_geometric_mean(const Tensor<T> &tensor, size_t ax
 }
 
 template <typename T>
-T TensorAgg<T>::sum_all(const Tensor<T> &tensor) {
+T TensorAgg<T>::sum_all(const TensorView<T> &tensor) {
   if (tensor.dim() == 0)
     throw TensorAggError("Tensor has dimension zero.");
 
   T resp = 0.0;
-  for (size_t i{0}; i < tensor.dim(); ++i)
-    resp += tensor.data()[i];
+  tensor.for_each([&resp](size_t, const T &value) { resp += value; });
 
   return resp;
 }
@@ -391,13 +746,15 @@ T TensorAgg<T>::median(std::vector<T> &values) {
   if (values.size() == 1)
     return values[0];
 
-  std::sort(std::begin(values), std::end(values));
-
   auto index = values.size() / 2;
+  auto middle = std::begin(values) + static_cast<std::ptrdiff_t>(index);
+  std::nth_element(std::begin(values), middle, std::end(values));
   if (values.size() % 2 != 0)
-    return values[index];
+    return *middle;
 
-  return (values[index] + values[index - 1]) / 2;
+  // The lower middle value is the largest of the partition below the upper one
+  T lower = *std::max_element(std::begin(values), middle);
+  return (*middle + lower) / 2;
 }
 
 template <typename T>
@@ -417,18 +774,10 @@ T TensorAgg<T>::variance(std::vector<T> &values) {
   if (values.size() == 1)
     return values[0];
 
-  T mean = 0.0;
-  for (const auto &item : values)
-    mean += item;
-  mean /= values.size();
-
-  T resp = 0.0;
-  for (const auto &item : values) {
-    auto dif = (item - mean);
-    resp += dif * dif;
-  }
+  RunningStats<T> stats;
+  stats.push(values);
 
-  return resp / (values.size() - 1.);
+  return stats.variance();
 }
 
 template <typename T>
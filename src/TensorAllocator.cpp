@@ -0,0 +1,297 @@
+#include "txeo/TensorAllocator.h"
+#include "txeo/detail/TensorAllocatorPrivate.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace txeo {
+
+namespace detail {
+
+namespace {
+
+struct BlockHeader {
+    size_t total;
+    size_t alignment;
+    size_t bytes;
+};
+
+thread_local TensorAllocator *current_allocator{nullptr};
+
+} // namespace
+
+std::string AllocatorAdapter::Name() {
+  auto *owner = _owner.load();
+  return owner != nullptr ? owner->name() : "txeo_retired";
+}
+
+void *AllocatorAdapter::AllocateRaw(size_t alignment, size_t num_bytes) {
+  auto *owner = _owner.load();
+  if (owner == nullptr)
+    return nullptr;
+
+  alignment = std::max(alignment, alignof(BlockHeader));
+  auto padding = ((sizeof(BlockHeader) + alignment - 1) / alignment) * alignment;
+  auto total = num_bytes + padding;
+  auto *block = static_cast<std::byte *>(owner->allocate(total, alignment));
+  if (block == nullptr)
+    return nullptr;
+
+  auto *ptr = block + padding;
+  new (ptr - sizeof(BlockHeader)) BlockHeader{total, alignment, num_bytes};
+
+  _references.fetch_add(1, std::memory_order_relaxed);
+  _allocations.fetch_add(1, std::memory_order_relaxed);
+  auto in_use = _bytes_in_use.fetch_add(num_bytes, std::memory_order_relaxed) + num_bytes;
+  auto peak = _peak_bytes_in_use.load(std::memory_order_relaxed);
+  while (in_use > peak && !_peak_bytes_in_use.compare_exchange_weak(peak, in_use))
+    ;
+
+  return ptr;
+}
+
+void AllocatorAdapter::DeallocateRaw(void *ptr) {
+  if (ptr == nullptr)
+    return;
+
+  auto *bytes_ptr = static_cast<std::byte *>(ptr);
+  auto header = *reinterpret_cast<BlockHeader *>(bytes_ptr - sizeof(BlockHeader));
+  auto *block = bytes_ptr - (header.total - header.bytes);
+
+  _deallocations.fetch_add(1, std::memory_order_relaxed);
+  _bytes_in_use.fetch_sub(header.bytes, std::memory_order_relaxed);
+
+  if (auto *owner = _owner.load(); owner != nullptr)
+    owner->deallocate(block, header.total, header.alignment);
+
+  this->unref();
+}
+
+AllocatorStats AllocatorAdapter::stats() const {
+  return AllocatorStats{_allocations.load(), _deallocations.load(), _reuses.load(),
+                        _bytes_in_use.load(), _peak_bytes_in_use.load()};
+}
+
+void AllocatorAdapter::retire(std::function<void()> release) {
+  _release = std::move(release);
+  _owner.store(nullptr);
+  this->unref();
+}
+
+void AllocatorAdapter::unref() {
+  if (_references.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    return;
+  if (_release)
+    _release();
+  delete this;
+}
+
+tensorflow::Allocator *AllocatorAdapter::current() {
+  return current_allocator != nullptr ? current_allocator->_adapter : nullptr;
+}
+
+} // namespace detail
+
+TensorAllocator::TensorAllocator() : _adapter{new detail::AllocatorAdapter{this}} {
+}
+
+TensorAllocator::~TensorAllocator() {
+  if (_adapter != nullptr)
+    this->retire({});
+}
+
+AllocatorStats TensorAllocator::stats() const {
+  return _adapter->stats();
+}
+
+void TensorAllocator::record_reuse() {
+  _adapter->record_reuse();
+}
+
+void TensorAllocator::retire(std::function<void()> release) {
+  auto *adapter = std::exchange(_adapter, nullptr);
+  adapter->retire(std::move(release));
+}
+
+namespace {
+
+constexpr size_t min_block_log = 6;
+constexpr size_t min_block_bytes = size_t{1} << min_block_log;
+constexpr size_t pool_alignment = 64;
+constexpr size_t num_size_classes =
+    (std::bit_width(PoolAllocator::max_pooled_bytes - 1) - 1 - min_block_log) * 4 + 5;
+
+// Four classes per power of two keep the rounding waste below 25%
+size_t size_class(size_t bytes, size_t &class_bytes) {
+  if (bytes <= min_block_bytes) {
+    class_bytes = min_block_bytes;
+    return 0;
+  }
+  auto log = static_cast<size_t>(std::bit_width(bytes - 1) - 1);
+  auto base = size_t{1} << log;
+  auto step = base / 4;
+  auto sub = (bytes - base + step - 1) / step;
+  class_bytes = base + sub * step;
+  return (log - min_block_log) * 4 + sub;
+}
+
+void *system_allocate(size_t bytes, size_t alignment) {
+  return ::operator new(bytes, std::align_val_t{alignment});
+}
+
+void system_deallocate(void *ptr, size_t alignment) {
+  ::operator delete(ptr, std::align_val_t{alignment});
+}
+
+struct ThreadCache {
+    std::array<std::vector<void *>, num_size_classes> free_lists;
+
+    void release() {
+      for (auto &list : free_lists) {
+        for (auto *item : list)
+          system_deallocate(item, pool_alignment);
+        list.clear();
+      }
+    }
+
+    ~ThreadCache();
+};
+
+// Tensors destroyed by other thread_local destructors may be released after the cache is gone
+thread_local bool cache_alive{false};
+thread_local ThreadCache thread_cache;
+
+ThreadCache::~ThreadCache() {
+  cache_alive = false;
+  this->release();
+}
+
+ThreadCache *get_thread_cache() {
+  static thread_local bool initialized{false};
+  if (!initialized) {
+    initialized = true;
+    cache_alive = true;
+    (void)thread_cache;
+  }
+  return cache_alive ? &thread_cache : nullptr;
+}
+
+} // namespace
+
+PoolAllocator &PoolAllocator::instance() {
+  // Never destroyed, so that buffers released during static destruction still find their pool
+  static auto *pool = new PoolAllocator();
+  return *pool;
+}
+
+void *PoolAllocator::allocate(size_t bytes, size_t alignment) {
+  if (bytes > max_pooled_bytes || alignment > pool_alignment)
+    return system_allocate(bytes, std::max(alignment, pool_alignment));
+
+  size_t class_bytes{0};
+  auto index = size_class(bytes, class_bytes);
+  if (auto *cache = get_thread_cache(); cache != nullptr) {
+    auto &list = cache->free_lists[index];
+    if (!list.empty()) {
+      auto *resp = list.back();
+      list.pop_back();
+      this->record_reuse();
+      return resp;
+    }
+  }
+
+  return system_allocate(class_bytes, pool_alignment);
+}
+
+void PoolAllocator::deallocate(void *ptr, size_t bytes, size_t alignment) {
+  if (bytes > max_pooled_bytes || alignment > pool_alignment) {
+    system_deallocate(ptr, std::max(alignment, pool_alignment));
+    return;
+  }
+
+  size_t class_bytes{0};
+  auto index = size_class(bytes, class_bytes);
+  if (auto *cache = get_thread_cache(); cache != nullptr) {
+    auto &list = cache->free_lists[index];
+    if (list.size() < max_cached_blocks) {
+      list.emplace_back(ptr);
+      return;
+    }
+  }
+
+  system_deallocate(ptr, pool_alignment);
+}
+
+void PoolAllocator::trim() {
+  if (auto *cache = get_thread_cache(); cache != nullptr)
+    cache->release();
+}
+
+TensorArena::TensorArena(size_t chunk_bytes) : _chunk_bytes{chunk_bytes} {
+  if (chunk_bytes == 0)
+    throw TensorAllocatorError("Chunk size must be positive.");
+}
+
+TensorArena::~TensorArena() {
+  auto chunks = std::make_shared<std::vector<Chunk>>(std::move(_chunks));
+  this->retire([chunks]() { chunks->clear(); });
+}
+
+void *TensorArena::allocate(size_t bytes, size_t alignment) {
+  auto align_in = [alignment](const Chunk &chunk, size_t offset) {
+    auto base = reinterpret_cast<uintptr_t>(chunk.memory.get());
+    auto aligned = (base + offset + alignment - 1) / alignment * alignment;
+    return static_cast<size_t>(aligned - base);
+  };
+
+  if (!_chunks.empty()) {
+    auto &chunk = _chunks.back();
+    auto start = align_in(chunk, _offset);
+    if (start + bytes <= chunk.size) {
+      _offset = start + bytes;
+      ++_live;
+      this->record_reuse();
+      return chunk.memory.get() + start;
+    }
+  }
+
+  auto size = std::max(_chunk_bytes, bytes + alignment);
+  _chunks.push_back(Chunk{std::unique_ptr<std::byte[]>(new std::byte[size]), size});
+  _reserved += size;
+  auto &chunk = _chunks.back();
+  auto start = align_in(chunk, 0);
+  _offset = start + bytes;
+  ++_live;
+
+  return chunk.memory.get() + start;
+}
+
+void TensorArena::deallocate(void *, size_t, size_t) {
+  // Once every buffer is back, the newest chunk is rewound and the others are dropped, so an arena
+  // reused across the iterations of a loop settles on a single chunk
+  if (--_live != 0 || _chunks.empty())
+    return;
+  auto last = std::move(_chunks.back());
+  _chunks.clear();
+  _reserved = last.size;
+  _chunks.emplace_back(std::move(last));
+  _offset = 0;
+}
+
+AllocatorScope::AllocatorScope(TensorAllocator &allocator)
+    : _previous{std::exchange(detail::current_allocator, &allocator)} {
+}
+
+AllocatorScope::~AllocatorScope() {
+  detail::current_allocator = _previous;
+}
+
+TensorAllocator *AllocatorScope::current() {
+  return detail::current_allocator;
+}
+
+} // namespace txeo
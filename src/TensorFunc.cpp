@@ -1,7 +1,9 @@
 #include "txeo/TensorFunc.h"
 #include "txeo/Matrix.h"
+#include "txeo/RunningStats.h"
 #include "txeo/Tensor.h"
 #include "txeo/TensorOp.h"
+#include "txeo/detail/Gemm.h"
 #include "txeo/detail/TensorHelper.h"
 #include "txeo/detail/utils.h"
 #include "txeo/types.h"
@@ -93,7 +95,8 @@ Tensor<T> TensorFunc<T>::abs(const Tensor<T> &tensor) {
 
   try {
     auto resp = detail::TensorHelper::reduce_tensor<T>(
-        *tensor._impl->tf_tensor, [](const tf::Scope &scope, tf::Input input) -> tf::Output {
+        *tensor._impl->tf_tensor, "Abs",
+        [](const tf::Scope &scope, tf::Input input) -> tf::Output {
           return tf::ops::Abs(scope, input);
         });
     return resp;
@@ -131,7 +134,8 @@ Tensor<T> TensorFunc<T>::permute(const Tensor<T> &tensor, const std::vector<size
     perm_flat(i) = detail::to_int64((axes[i]));
 
   return detail::TensorHelper::ope_tensors<T>(
-      *tensor._impl->tf_tensor, perm, [](const tf::Scope &scope, tf::Input left, tf::Input right) {
+      *tensor._impl->tf_tensor, perm, "Transpose",
+      [](const tf::Scope &scope, tf::Input left, tf::Input right) {
         return tf::ops::Transpose(scope, left, right);
       });
 }
@@ -191,17 +195,10 @@ void TensorFunc<T>::z_score_normalize(const std::vector<T> &values,
   if (values.size() == 1)
     return;
 
-  T mean = 0.0;
-  for (const auto &item : values)
-    mean += item;
-  mean /= values.size();
-
-  T variance_num = 0.0;
-  for (const auto &item : values) {
-    auto dif = (item - mean);
-    variance_num += dif * dif;
-  }
-  auto std_dev = std::sqrt(variance_num / values.size());
+  RunningStats<T> stats;
+  stats.push(values);
+  auto mean = stats.mean();
+  auto std_dev = stats.population_standard_deviation();
 
   if (detail::is_zero(std_dev)) {
     for (size_t i{0}; i < addresses.size(); ++i)
@@ -276,20 +273,10 @@ void TensorFunc<T>::z_score_subtractor_denominator(const std::vector<T> &values,
   if (values.size() == 1)
     return;
 
-  T mean = 0.0;
-  for (const auto &item : values)
-    mean += item;
-  mean /= values.size();
-
-  T variance_num = 0.0;
-  for (const auto &item : values) {
-    auto dif = (item - mean);
-    variance_num += dif * dif;
-  }
-  auto std_dev = std::sqrt(variance_num / (values.size()));
-
-  subtractor = mean;
-  denominator = std_dev;
+  RunningStats<T> stats;
+  stats.push(values);
+  subtractor = stats.mean();
+  denominator = stats.population_standard_deviation();
 }
 
 template <typename T>
@@ -400,20 +387,10 @@ void TensorFunc<T>::z_score_normalize(const Tensor<T> &tensor, T &subtractor, T
   if (tensor.dim() == 1)
     return;
 
-  T mean = 0.0;
-  for (auto &element : tensor)
-    mean += element;
-  mean /= tensor.dim();
-
-  T variance_num = 0.0;
-  for (const auto &element : tensor) {
-    auto dif = (element - mean);
-    variance_num += dif * dif;
-  }
-  auto std_dev = std::sqrt(variance_num / tensor.dim());
-
-  subtractor = mean;
-  denominator = std_dev;
+  RunningStats<T> stats;
+  stats.push(tensor.data(), tensor.dim());
+  subtractor = stats.mean();
+  denominator = stats.population_standard_deviation();
 }
 
 template <typename T>
@@ -469,6 +446,14 @@ Tensor<T> TensorFunc<T>::normalize(const Tensor<T> &tensor, NormalizationType ty
 
 template <typename T>
 Matrix<T> TensorFunc<T>::compute_gram_matrix(const Matrix<T> &matrix) {
+  auto m = matrix.row_size();
+  auto n = matrix.col_size();
+  if (m > 0 && n > 0 && detail::use_native_gemm<T>(n, n, m)) {
+    Matrix<T> resp(n, n);
+    detail::gemm(true, false, n, n, m, matrix.data(), matrix.data(), resp.data());
+    return resp;
+  }
+
   auto resp = TensorFunc<T>::transpose(matrix);
 
   return TensorOp<T>::dot(resp, matrix);
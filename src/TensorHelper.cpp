@@ -0,0 +1,162 @@
+#include "txeo/detail/TensorHelper.h"
+#include "txeo/detail/utils.h"
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tensorflow/cc/client/client_session.h>
+#include <tensorflow/cc/framework/ops.h>
+#include <tensorflow/cc/framework/scope.h>
+#include <tensorflow/cc/ops/array_ops.h>
+#include <tensorflow/core/framework/partial_tensor_shape.h>
+#include <tensorflow/core/framework/tensor.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace tf = tensorflow;
+
+namespace txeo::detail {
+
+namespace {
+
+// Bounds the memory held by graphs created for unusual axes combinations
+constexpr size_t max_cached_graphs{512};
+
+struct CachedGraph {
+    tf::Scope root{tf::Scope::NewRootScope()};
+    std::vector<tf::Output> placeholders;
+    tf::Output output;
+    std::unique_ptr<tf::ClientSession> session{nullptr};
+};
+
+struct CacheEntry {
+    std::shared_ptr<CachedGraph> graph;
+    std::list<std::string>::iterator position;
+};
+
+// Graphs by key, with the keys ordered from the most to the least recently used
+struct GraphCache {
+    std::mutex mutex;
+    bool enabled{true};
+    std::list<std::string> recency;
+    std::unordered_map<std::string, CacheEntry> graphs;
+
+    // Returns the graph of the key, marking it as the most recently used (call under the mutex)
+    std::shared_ptr<CachedGraph> find(const std::string &key) {
+      auto item = graphs.find(key);
+      if (item == std::end(graphs))
+        return nullptr;
+      recency.splice(std::begin(recency), recency, item->second.position);
+      return item->second.graph;
+    }
+
+    // Adds a graph, evicting the least recently used one when full (call under the mutex)
+    void insert(const std::string &key, std::shared_ptr<CachedGraph> graph) {
+      if (graphs.size() >= max_cached_graphs) {
+        graphs.erase(recency.back());
+        recency.pop_back();
+      }
+      recency.emplace_front(key);
+      graphs.emplace(key, CacheEntry{std::move(graph), std::begin(recency)});
+    }
+
+    void clear() {
+      graphs.clear();
+      recency.clear();
+    }
+};
+
+GraphCache &graph_cache() {
+  static GraphCache cache;
+  return cache;
+}
+
+std::string make_key(const std::string &op_name, const std::vector<int64_t> &attrs,
+                     const std::vector<tf::Tensor> &inputs) {
+  std::string resp{op_name};
+  for (const auto &item : inputs)
+    resp += "|" + std::to_string(item.dtype()) + ":" + std::to_string(item.dims());
+  resp += "|";
+  for (const auto &item : attrs)
+    resp += std::to_string(item) + ",";
+
+  return resp;
+}
+
+std::shared_ptr<CachedGraph> build_graph(const std::vector<tf::Tensor> &inputs,
+                                         const TensorHelper::GraphFunc &func) {
+  auto resp = std::make_shared<CachedGraph>();
+  for (const auto &item : inputs) {
+    tf::PartialTensorShape shape{std::vector<int64_t>(item.dims(), -1)};
+    resp->placeholders.emplace_back(tf::ops::Placeholder(
+        resp->root, item.dtype(), tf::ops::Placeholder::Attrs().Shape(shape)));
+  }
+  resp->output = func(resp->root, resp->placeholders);
+  if (!resp->root.ok())
+    throw std::runtime_error(resp->root.status().ToString());
+  resp->session = std::make_unique<tf::ClientSession>(resp->root);
+
+  return resp;
+}
+
+} // namespace
+
+tf::Tensor TensorHelper::run_graph(const std::string &op_name, const std::vector<int64_t> &attrs,
+                                   const std::vector<tf::Tensor> &inputs, GraphFunc func) {
+  auto &cache = graph_cache();
+  auto key = make_key(op_name, attrs, inputs);
+  std::shared_ptr<CachedGraph> graph{nullptr};
+  {
+    std::lock_guard<std::mutex> lg{cache.mutex};
+    if (cache.enabled)
+      graph = cache.find(key);
+  }
+
+  // Graphs are built without holding the lock, so lookups of other keys are not delayed. When
+  // another thread cached the same key meanwhile, its graph is kept and this one is dropped
+  if (!graph) {
+    graph = build_graph(inputs, func);
+    std::lock_guard<std::mutex> lg{cache.mutex};
+    if (cache.enabled) {
+      if (auto cached = cache.find(key))
+        graph = std::move(cached);
+      else
+        cache.insert(key, graph);
+    }
+  }
+
+  tf::ClientSession::FeedType feeds;
+  for (size_t i{0}; i < inputs.size(); ++i)
+    feeds.emplace(graph->placeholders[i], inputs[i]);
+
+  std::vector<tf::Tensor> outputs;
+  auto status = graph->session->Run(feeds, {graph->output}, &outputs);
+  if (!status.ok())
+    throw std::runtime_error(status.ToString());
+
+  return std::move(outputs[0]);
+}
+
+void TensorHelper::enable_graph_cache(bool enable) {
+  auto &cache = graph_cache();
+  std::lock_guard<std::mutex> lg{cache.mutex};
+  cache.enabled = enable;
+  if (!enable)
+    cache.clear();
+}
+
+void TensorHelper::clear_graph_cache() {
+  auto &cache = graph_cache();
+  std::lock_guard<std::mutex> lg{cache.mutex};
+  cache.clear();
+}
+
+size_t TensorHelper::graph_cache_size() {
+  auto &cache = graph_cache();
+  std::lock_guard<std::mutex> lg{cache.mutex};
+  return cache.graphs.size();
+}
+
+} // namespace txeo::detail
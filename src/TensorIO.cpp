@@ -1,17 +1,127 @@
 #include "txeo/TensorIO.h"
 #include "txeo/Tensor.h"
 #include "txeo/TensorShape.h"
+#include "txeo/detail/TensorHelper.h"
+#include "txeo/detail/TextWriter.h"
 #include "txeo/detail/utils.h"
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fcntl.h>
 #include <fstream>
 #include <initializer_list>
 #include <iterator>
+#include <limits>
 #include <sstream>
 #include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <tensorflow/core/framework/allocation_description.pb.h>
+#include <unistd.h>
+#include <vector>
 
 namespace txeo {
 
+namespace {
+
+constexpr std::array<char, 8> binary_magic{'T', 'X', 'E', 'O', 'T', 'N', 'S', 'R'};
+constexpr uint32_t binary_version{1};
+constexpr uint32_t binary_byte_order{0x01020304};
+
+// Fixed part of the header, followed by `order` uint64 dimensions and padding up to data_offset.
+// Fields are stored in the byte order of the writer, recorded in byte_order.
+struct BinaryHeader {
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t dtype;
+    uint32_t element_size;
+    uint64_t order;
+    uint64_t alignment;
+    uint64_t data_offset;
+    uint64_t data_bytes;
+};
+
+struct BinaryLayout {
+    std::vector<size_t> dims;
+    size_t data_offset{0};
+    size_t data_bytes{0};
+};
+
+template <typename T>
+BinaryLayout read_binary_layout(std::istream &rf, size_t file_size) {
+  BinaryHeader header{};
+  if (!rf.read(reinterpret_cast<char *>(&header), sizeof(header)) || header.magic != binary_magic)
+    throw TensorIOError("Not a binary tensor file!");
+  if (header.version != binary_version)
+    throw TensorIOError("Unsupported binary tensor file version!");
+  if (header.byte_order != binary_byte_order)
+    throw TensorIOError("Binary tensor file written with a different byte order!");
+  if (header.dtype != static_cast<uint32_t>(detail::get_tf_dtype<T>()) ||
+      header.element_size != sizeof(T))
+    throw TensorIOError("Element type does not match the type of the file!");
+
+  if (header.order > (file_size - sizeof(header)) / sizeof(uint64_t))
+    throw TensorIOError("Truncated binary tensor file!");
+
+  BinaryLayout resp;
+  resp.dims.resize(header.order);
+  size_t n_elem{1};
+  for (auto &dim : resp.dims) {
+    uint64_t aux{0};
+    if (!rf.read(reinterpret_cast<char *>(&aux), sizeof(aux)))
+      throw TensorIOError("Truncated binary tensor file!");
+    dim = aux;
+    if (dim != 0 && n_elem > std::numeric_limits<size_t>::max() / sizeof(T) / dim)
+      throw TensorIOError("Invalid shape in binary tensor file!");
+    n_elem *= dim;
+  }
+  resp.data_offset = header.data_offset;
+  resp.data_bytes = header.data_bytes;
+
+  // The alignment recorded in the file is not trusted: a mapped data section must be aligned for T
+  constexpr size_t data_alignment = std::max(alignof(T), TensorIO::binary_alignment);
+  auto header_bytes = sizeof(header) + header.order * sizeof(uint64_t);
+  if (resp.data_bytes != n_elem * sizeof(T) || resp.data_offset < header_bytes ||
+      resp.data_offset % data_alignment != 0)
+    throw TensorIOError("Inconsistent binary tensor file header!");
+  if (resp.data_offset > file_size || file_size - resp.data_offset < resp.data_bytes)
+    throw TensorIOError("Truncated binary tensor file!");
+
+  return resp;
+}
+
+// Tensor buffer owning a private, writable mapping of a binary tensor file
+class MappedBuffer : public tf::TensorBuffer {
+  public:
+    MappedBuffer(void *mapping, size_t mapping_size, size_t offset, size_t bytes)
+        : tf::TensorBuffer(static_cast<char *>(mapping) + offset), _mapping{mapping},
+          _mapping_size{mapping_size}, _bytes{bytes} {}
+
+    MappedBuffer(const MappedBuffer &) = delete;
+    MappedBuffer(MappedBuffer &&) = delete;
+    MappedBuffer &operator=(const MappedBuffer &) = delete;
+    MappedBuffer &operator=(MappedBuffer &&) = delete;
+    ~MappedBuffer() override { munmap(_mapping, _mapping_size); }
+
+    [[nodiscard]] size_t size() const override { return _bytes; }
+
+    tf::TensorBuffer *root_buffer() override { return this; }
+
+    void FillAllocationDescription(tf::AllocationDescription *proto) const override {
+      proto->set_requested_bytes(static_cast<int64_t>(_bytes));
+      proto->set_allocator_name("txeo_mmap");
+    }
+
+  private:
+    void *_mapping;
+    size_t _mapping_size;
+    size_t _bytes;
+};
+
+} // namespace
+
 template <typename T>
 Tensor<T> TensorIO::read_text_file(bool has_header) const {
   std::string line;
@@ -77,19 +187,7 @@ void TensorIO::write_text_file(const Tensor<T> &tensor) const {
   if (wf.is_open()) {
     size_t n_rows = detail::to_size_t(tensor.shape().axis_dim(0));
     size_t n_cols = detail::to_size_t(tensor.shape().axis_dim(1));
-    auto iterator = std::cbegin(tensor);
-    size_t aux_r{0};
-    while (aux_r < n_rows) {
-      size_t aux_c{0};
-      while (aux_c < n_cols) {
-        wf << std::to_string(*iterator);
-        ++iterator;
-        if (++aux_c < n_cols)
-          wf << _separator;
-      }
-      if (++aux_r < n_rows)
-        wf << "\n";
-    }
+    detail::write_text(wf, tensor.data(), n_rows, n_cols, _separator);
     wf.close();
   } else
     throw TensorIOError("Could not open file!");
@@ -100,31 +198,99 @@ template <typename T>
 void TensorIO::write_text_file(const Tensor<T> &tensor, size_t precision) const {
   if (precision <= 1)
     throw TensorIOError("Precision must be greater than 1!");
-  auto prec = precision - 1;
   if (tensor.order() != 2)
     throw TensorIOError("Tensor is not a matrix!");
   std::ofstream wf{_path, std::ios::out};
   if (wf.is_open()) {
     size_t n_rows = detail::to_size_t(tensor.shape().axis_dim(0));
     size_t n_cols = detail::to_size_t(tensor.shape().axis_dim(1));
-    auto iterator = std::cbegin(tensor);
-    size_t aux_r{0};
-    while (aux_r < n_rows) {
-      size_t aux_c{0};
-      while (aux_c < n_cols) {
-        wf << detail::format(*iterator, prec);
-        ++iterator;
-        if (++aux_c < n_cols)
-          wf << _separator;
-      }
-      if (++aux_r < n_rows)
-        wf << "\n";
-    }
+    detail::write_text(wf, tensor.data(), n_rows, n_cols, _separator, detail::to_int(precision));
     wf.close();
   } else
     throw TensorIOError("Could not open file!");
 }
 
+template <typename T>
+void TensorIO::write_binary_file(const Tensor<T> &tensor) const {
+  std::ofstream wf{_path, std::ios::out | std::ios::binary};
+  if (!wf.is_open())
+    throw TensorIOError("Could not open file!");
+
+  auto dims = tensor.shape().axes_dims();
+  auto header_bytes = sizeof(BinaryHeader) + dims.size() * sizeof(uint64_t);
+  BinaryHeader header{};
+  header.magic = binary_magic;
+  header.version = binary_version;
+  header.byte_order = binary_byte_order;
+  header.dtype = static_cast<uint32_t>(detail::get_tf_dtype<T>());
+  header.element_size = sizeof(T);
+  header.order = dims.size();
+  header.alignment = binary_alignment;
+  header.data_offset = (header_bytes + binary_alignment - 1) / binary_alignment * binary_alignment;
+  header.data_bytes = tensor.dim() * sizeof(T);
+
+  wf.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  for (auto dim : dims) {
+    auto aux = static_cast<uint64_t>(dim);
+    wf.write(reinterpret_cast<const char *>(&aux), sizeof(aux));
+  }
+  std::array<char, binary_alignment> padding{};
+  wf.write(padding.data(), static_cast<std::streamsize>(header.data_offset - header_bytes));
+  wf.write(reinterpret_cast<const char *>(tensor.data()),
+           static_cast<std::streamsize>(header.data_bytes));
+  if (!wf)
+    throw TensorIOError("Could not write file!");
+}
+
+template <typename T>
+Tensor<T> TensorIO::read_binary_file() const {
+  std::ifstream rf{_path, std::ios::in | std::ios::binary};
+  if (!rf.is_open())
+    throw TensorIOError("Could not open file!");
+
+  auto layout = read_binary_layout<T>(rf, std::filesystem::file_size(_path));
+  Tensor<T> resp{TensorShape(std::move(layout.dims))};
+  rf.seekg(static_cast<std::streamoff>(layout.data_offset));
+  if (!rf.read(reinterpret_cast<char *>(resp.data()),
+               static_cast<std::streamsize>(layout.data_bytes)))
+    throw TensorIOError("Truncated binary tensor file!");
+
+  return resp;
+}
+
+template <typename T>
+Tensor<T> TensorIO::map_binary_file() const {
+  BinaryLayout layout;
+  size_t file_size{0};
+  {
+    std::ifstream rf{_path, std::ios::in | std::ios::binary};
+    if (!rf.is_open())
+      throw TensorIOError("Could not open file!");
+    file_size = std::filesystem::file_size(_path);
+    layout = read_binary_layout<T>(rf, file_size);
+  }
+  if (layout.data_bytes == 0)
+    return Tensor<T>{TensorShape(std::move(layout.dims))};
+
+  auto fd = ::open(_path.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw TensorIOError("Could not open file!");
+  // A private mapping may be written to without touching the file, even if opened read-only
+  auto *mapping = ::mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapping == MAP_FAILED)
+    throw TensorIOError("Could not map file!");
+
+  tf::TensorShape shape;
+  for (auto dim : layout.dims)
+    shape.AddDim(detail::to_int64(dim));
+  auto *buffer = new MappedBuffer(mapping, file_size, layout.data_offset, layout.data_bytes);
+  tf::Tensor tf_tensor{detail::get_tf_dtype<T>(), shape, buffer};
+  buffer->Unref();
+
+  return detail::TensorHelper::to_txeo_tensor<T>(std::move(tf_tensor));
+}
+
 template Tensor<short> TensorIO::read_text_file<short>(bool has_header) const;
 template Tensor<int> TensorIO::read_text_file<int>(bool has_header) const;
 template Tensor<bool> TensorIO::read_text_file<bool>(bool has_header) const;
@@ -146,4 +312,31 @@ template void TensorIO::write_text_file(const Tensor<size_t> &tensor) const;
 template void TensorIO::write_text_file(const Tensor<float> &tensor, size_t precision) const;
 template void TensorIO::write_text_file(const Tensor<double> &tensor, size_t precision) const;
 
+template void TensorIO::write_binary_file(const Tensor<short> &tensor) const;
+template void TensorIO::write_binary_file(const Tensor<int> &tensor) const;
+template void TensorIO::write_binary_file(const Tensor<bool> &tensor) const;
+template void TensorIO::write_binary_file(const Tensor<long> &tensor) const;
+template void TensorIO::write_binary_file(const Tensor<long long> &tensor) const;
+template void TensorIO::write_binary_file(const Tensor<float> &tensor) const;
+template void TensorIO::write_binary_file(const Tensor<double> &tensor) const;
+template void TensorIO::write_binary_file(const Tensor<size_t> &tensor) const;
+
+template Tensor<short> TensorIO::read_binary_file<short>() const;
+template Tensor<int> TensorIO::read_binary_file<int>() const;
+template Tensor<bool> TensorIO::read_binary_file<bool>() const;
+template Tensor<long> TensorIO::read_binary_file<long>() const;
+template Tensor<long long> TensorIO::read_binary_file<long long>() const;
+template Tensor<float> TensorIO::read_binary_file<float>() const;
+template Tensor<double> TensorIO::read_binary_file<double>() const;
+template Tensor<size_t> TensorIO::read_binary_file<size_t>() const;
+
+template Tensor<short> TensorIO::map_binary_file<short>() const;
+template Tensor<int> TensorIO::map_binary_file<int>() const;
+template Tensor<bool> TensorIO::map_binary_file<bool>() const;
+template Tensor<long> TensorIO::map_binary_file<long>() const;
+template Tensor<long long> TensorIO::map_binary_file<long long>() const;
+template Tensor<float> TensorIO::map_binary_file<float>() const;
+template Tensor<double> TensorIO::map_binary_file<double>() const;
+template Tensor<size_t> TensorIO::map_binary_file<size_t>() const;
+
 } // namespace txeo
@@ -1,9 +1,13 @@
 #include "txeo/TensorOp.h"
 #include "txeo/Matrix.h"
 #include "txeo/Tensor.h"
+#include "txeo/TensorView.h"
+#include "txeo/detail/Elementwise.h"
+#include "txeo/detail/Gemm.h"
 #include "txeo/detail/TensorHelper.h"
 #include "txeo/detail/utils.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <tensorflow/cc/framework/ops.h>
@@ -17,6 +21,64 @@ namespace txeo {
 template <typename T>
 class Vector;
 
+namespace {
+
+template <typename T>
+bool has_zero(const Tensor<T> &tensor) {
+  auto data = tensor.data();
+  return std::any_of(data, data + tensor.dim(), detail::is_zero<T>);
+}
+
+template <typename T>
+inline T combine(detail::ElementOp op, T left, T right) {
+  switch (op) {
+  case detail::ElementOp::SUM:
+    return static_cast<T>(left + right);
+  case detail::ElementOp::SUBTRACT:
+    return static_cast<T>(left - right);
+  case detail::ElementOp::MULTIPLY:
+    return static_cast<T>(left * right);
+  case detail::ElementOp::DIVIDE:
+    return static_cast<T>(left / right);
+  }
+  return left;
+}
+
+// Contiguous operands go straight to the kernels. Otherwise one operand is gathered into the
+// result, which then serves as the aliased operand of the kernel, so no temporary is allocated
+template <typename T>
+Tensor<T> elementwise_views(detail::ElementOp op, const TensorView<T> &left,
+                            const TensorView<T> &right) {
+  if (left.dim() == 0 || right.dim() == 0)
+    throw TensorOpError("One of the operands has dimension zero.");
+  if (left.shape() != right.shape())
+    throw TensorOpError("Operands have different shapes.");
+
+  Tensor<T> resp(left.shape());
+  auto *resp_data = resp.data();
+  auto size = left.dim();
+  auto gather = [resp_data](size_t i, const T &value) { resp_data[i] = value; };
+
+  if (left.is_contiguous() && right.is_contiguous()) {
+    detail::elementwise(op, left.data(), right.data(), resp_data, size);
+  } else if (right.is_contiguous()) {
+    left.for_each(gather);
+    detail::elementwise(op, static_cast<const T *>(resp_data), right.data(), resp_data, size);
+  } else if (left.is_contiguous()) {
+    right.for_each(gather);
+    detail::elementwise(op, left.data(), static_cast<const T *>(resp_data), resp_data, size);
+  } else {
+    left.for_each(gather);
+    right.for_each([op, resp_data](size_t i, const T &value) {
+      resp_data[i] = combine(op, resp_data[i], value);
+    });
+  }
+
+  return resp;
+}
+
+} // namespace
+
 template <typename T>
 Tensor<T> TensorOp<T>::sum(const Tensor<T> &left, const Tensor<T> &right) {
   if (left.dim() == 0 || right.dim() == 0)
@@ -25,8 +87,7 @@ Tensor<T> TensorOp<T>::sum(const Tensor<T> &left, const Tensor<T> &right) {
     throw TensorOpError("Operands have different shapes.");
 
   Tensor<T> resp(left.shape());
-  for (size_t i{0}; i < resp.dim(); ++i)
-    resp.data()[i] = left.data()[i] + right.data()[i];
+  detail::elementwise(detail::ElementOp::SUM, left.data(), right.data(), resp.data(), resp.dim());
 
   return resp;
 }
@@ -38,8 +99,7 @@ Tensor<T> &TensorOp<T>::sum_by(Tensor<T> &left, const Tensor<T> &right) {
   if (left.shape() != right.shape())
     throw TensorOpError("Operands have different shapes.");
 
-  for (size_t i{0}; i < left.dim(); ++i)
-    left.data()[i] += right.data()[i];
+  detail::elementwise(detail::ElementOp::SUM, left.data(), right.data(), left.data(), left.dim());
 
   return left;
 }
@@ -50,8 +110,7 @@ Tensor<T> TensorOp<T>::sum(const Tensor<T> &left, const T &right) {
     throw TensorOpError("Left operand has dimension zero.");
 
   Tensor<T> resp(left.shape());
-  for (size_t i{0}; i < resp.dim(); ++i)
-    resp.data()[i] = left.data()[i] + right;
+  detail::elementwise(detail::ElementOp::SUM, left.data(), right, resp.data(), resp.dim());
 
   return resp;
 }
@@ -61,8 +120,7 @@ Tensor<T> &TensorOp<T>::sum_by(Tensor<T> &left, const T &right) {
   if (left.dim() == 0)
     throw TensorOpError("Left operand has dimension zero.");
 
-  for (size_t i{0}; i < left.dim(); ++i)
-    left.data()[i] += right;
+  detail::elementwise(detail::ElementOp::SUM, left.data(), right, left.data(), left.dim());
 
   return left;
 }
@@ -75,8 +133,8 @@ Tensor<T> TensorOp<T>::subtract(const Tensor<T> &left, const Tensor<T> &right) {
     throw TensorOpError("Operands have different shapes.");
 
   Tensor<T> resp(left.shape());
-  for (size_t i{0}; i < resp.dim(); ++i)
-    resp.data()[i] = left.data()[i] - right.data()[i];
+  detail::elementwise(detail::ElementOp::SUBTRACT, left.data(), right.data(), resp.data(),
+                      resp.dim());
 
   return resp;
 }
@@ -88,8 +146,8 @@ Tensor<T> &TensorOp<T>::subtract_by(Tensor<T> &left, const Tensor<T> &right) {
   if (left.shape() != right.shape())
     throw TensorOpError("Operands have different shapes.");
 
-  for (size_t i{0}; i < left.dim(); ++i)
-    left.data()[i] -= right.data()[i];
+  detail::elementwise(detail::ElementOp::SUBTRACT, left.data(), right.data(), left.data(),
+                      left.dim());
 
   return left;
 }
@@ -100,8 +158,7 @@ Tensor<T> TensorOp<T>::subtract(const Tensor<T> &left, const T &right) {
     throw TensorOpError("Left operand has dimension zero.");
 
   Tensor<T> resp(left.shape());
-  for (size_t i{0}; i < resp.dim(); ++i)
-    resp.data()[i] = left.data()[i] - right;
+  detail::elementwise(detail::ElementOp::SUBTRACT, left.data(), right, resp.data(), resp.dim());
 
   return resp;
 }
@@ -111,8 +168,7 @@ Tensor<T> &TensorOp<T>::subtract_by(Tensor<T> &left, const T &right) {
   if (left.dim() == 0)
     throw TensorOpError("Left operand has dimension zero.");
 
-  for (size_t i{0}; i < left.dim(); ++i)
-    left.data()[i] -= right;
+  detail::elementwise(detail::ElementOp::SUBTRACT, left.data(), right, left.data(), left.dim());
 
   return left;
 }
@@ -123,8 +179,7 @@ Tensor<T> TensorOp<T>::subtract(const T &left, const Tensor<T> &right) {
     throw TensorOpError("Right operand has dimension zero.");
 
   Tensor<T> resp(right.shape());
-  for (size_t i{0}; i < resp.dim(); ++i)
-    resp.data()[i] = left - right.data()[i];
+  detail::elementwise(detail::ElementOp::SUBTRACT, left, right.data(), resp.data(), resp.dim());
 
   return resp;
 }
@@ -134,8 +189,7 @@ const T &TensorOp<T>::subtract_by(const T &left, Tensor<T> &right) {
   if (right.dim() == 0)
     throw TensorOpError("Right operand has dimension zero.");
 
-  for (size_t i{0}; i < right.dim(); ++i)
-    right.data()[i] = left - right.data()[i];
+  detail::elementwise(detail::ElementOp::SUBTRACT, left, right.data(), right.data(), right.dim());
 
   return left;
 }
@@ -146,8 +200,7 @@ Tensor<T> TensorOp<T>::multiply(const Tensor<T> &tensor, const T &scalar) {
     throw TensorOpError("Tensor has dimension zero.");
 
   Tensor<T> resp(tensor.shape());
-  for (size_t i{0}; i < resp.dim(); ++i)
-    resp.data()[i] = tensor.data()[i] * scalar;
+  detail::elementwise(detail::ElementOp::MULTIPLY, tensor.data(), scalar, resp.data(), resp.dim());
 
   return resp;
 }
@@ -157,8 +210,8 @@ Tensor<T> &TensorOp<T>::multiply_by(Tensor<T> &tensor, const T &scalar) {
   if (tensor.dim() == 0)
     throw TensorOpError("Tensor has dimension zero.");
 
-  for (size_t i{0}; i < tensor.dim(); ++i)
-    tensor.data()[i] *= scalar;
+  detail::elementwise(detail::ElementOp::MULTIPLY, tensor.data(), scalar, tensor.data(),
+                      tensor.dim());
 
   return tensor;
 }
@@ -171,8 +224,7 @@ Tensor<T> TensorOp<T>::divide(const Tensor<T> &tensor, const T &scalar) {
     throw TensorOpError("Tensor has dimension zero.");
 
   Tensor<T> resp(tensor.shape());
-  for (size_t i{0}; i < resp.dim(); ++i)
-    resp.data()[i] = tensor.data()[i] / scalar;
+  detail::elementwise(detail::ElementOp::DIVIDE, tensor.data(), scalar, resp.data(), resp.dim());
 
   return resp;
 }
@@ -184,8 +236,8 @@ Tensor<T> &TensorOp<T>::divide_by(Tensor<T> &tensor, const T &scalar) {
   if (tensor.dim() == 0)
     throw TensorOpError("Tensor has dimension zero.");
 
-  for (size_t i{0}; i < tensor.dim(); ++i)
-    tensor.data()[i] /= scalar;
+  detail::elementwise(detail::ElementOp::DIVIDE, tensor.data(), scalar, tensor.data(),
+                      tensor.dim());
 
   return tensor;
 }
@@ -195,12 +247,11 @@ Tensor<T> TensorOp<T>::divide(const T &scalar, const Tensor<T> &tensor) {
   if (tensor.dim() == 0)
     throw TensorOpError("Right operand has dimension zero.");
 
+  if (has_zero(tensor))
+    throw TensorOpError("Zero element in right operand.");
+
   Tensor<T> resp(tensor.shape());
-  for (size_t i{0}; i < resp.dim(); ++i) {
-    if (detail::is_zero(tensor.data()[i]))
-      throw TensorOpError("Zero element in right operand.");
-    resp.data()[i] = scalar / tensor.data()[i];
-  }
+  detail::elementwise(detail::ElementOp::DIVIDE, scalar, tensor.data(), resp.data(), resp.dim());
 
   return resp;
 }
@@ -210,11 +261,11 @@ Tensor<T> &TensorOp<T>::divide_by(const T &scalar, Tensor<T> &tensor) {
   if (tensor.dim() == 0)
     throw TensorOpError("Tensor has dimension zero.");
 
-  for (size_t i{0}; i < tensor.dim(); ++i) {
-    if (detail::is_zero(tensor.data()[i]))
-      throw TensorOpError("Zero element in right operand.");
-    tensor.data()[i] = scalar / tensor.data()[i];
-  }
+  if (has_zero(tensor))
+    throw TensorOpError("Zero element in right operand.");
+
+  detail::elementwise(detail::ElementOp::DIVIDE, scalar, tensor.data(), tensor.data(),
+                      tensor.dim());
 
   return tensor;
 }
@@ -227,8 +278,8 @@ Tensor<T> TensorOp<T>::hadamard_prod(const Tensor<T> &left, const Tensor<T> &rig
     throw TensorOpError("Operands have different shapes.");
 
   Tensor<T> resp(left.shape());
-  for (size_t i{0}; i < resp.dim(); ++i)
-    resp.data()[i] = left.data()[i] * right.data()[i];
+  detail::elementwise(detail::ElementOp::MULTIPLY, left.data(), right.data(), resp.data(),
+                      resp.dim());
 
   return resp;
 }
@@ -240,8 +291,8 @@ Tensor<T> &TensorOp<T>::hadamard_prod_by(Tensor<T> &left, const Tensor<T> &right
   if (left.shape() != right.shape())
     throw TensorOpError("Operands have different shapes.");
 
-  for (size_t i{0}; i < left.dim(); ++i)
-    left.data()[i] *= right.data()[i];
+  detail::elementwise(detail::ElementOp::MULTIPLY, left.data(), right.data(), left.data(),
+                      left.dim());
 
   return left;
 }
@@ -253,12 +304,12 @@ Tensor<T> TensorOp<T>::hadamard_div(const Tensor<T> &left, const Tensor<T> &righ
   if (left.shape() != right.shape())
     throw TensorOpError("Operands have different shapes.");
 
+  if (has_zero(right))
+    throw TensorOpError("Zero element in right operand.");
+
   Tensor<T> resp(left.shape());
-  for (size_t i{0}; i < resp.dim(); ++i) {
-    if (detail::is_zero(right.data()[i]))
-      throw TensorOpError("Zero element in right operand.");
-    resp.data()[i] = left.data()[i] / right.data()[i];
-  }
+  detail::elementwise(detail::ElementOp::DIVIDE, left.data(), right.data(), resp.data(),
+                      resp.dim());
 
   return resp;
 }
@@ -270,11 +321,11 @@ Tensor<T> &TensorOp<T>::hadamard_div_by(Tensor<T> &left, const Tensor<T> &right)
   if (left.shape() != right.shape())
     throw TensorOpError("Operands have different shapes.");
 
-  for (size_t i{0}; i < left.dim(); ++i) {
-    if (detail::is_zero(right.data()[i]))
-      throw TensorOpError("Zero element in right operand.");
-    left.data()[i] /= right.data()[i];
-  }
+  if (has_zero(right))
+    throw TensorOpError("Zero element in right operand.");
+
+  detail::elementwise(detail::ElementOp::DIVIDE, left.data(), right.data(), left.data(),
+                      left.dim());
 
   return left;
 }
@@ -289,14 +340,72 @@ T TensorOp<T>::inner(const Tensor<T> &left, const Tensor<T> &right) {
 
   auto l_data = left.data();
   auto r_data = right.data();
+  auto size = left.dim();
 
   T resp = 0.0;
-  for (size_t i{0}; i < left.dim(); ++i)
+  for (size_t i{0}; i < size; ++i)
     resp += l_data[i] * r_data[i];
 
   return resp;
 }
 
+template <typename T>
+Tensor<T> TensorOp<T>::sum(const TensorView<T> &left, const TensorView<T> &right) {
+  return elementwise_views(detail::ElementOp::SUM, left, right);
+}
+
+template <typename T>
+Tensor<T> TensorOp<T>::subtract(const TensorView<T> &left, const TensorView<T> &right) {
+  return elementwise_views(detail::ElementOp::SUBTRACT, left, right);
+}
+
+template <typename T>
+Tensor<T> TensorOp<T>::hadamard_prod(const TensorView<T> &left, const TensorView<T> &right) {
+  return elementwise_views(detail::ElementOp::MULTIPLY, left, right);
+}
+
+template <typename T>
+Tensor<T> TensorOp<T>::multiply(const TensorView<T> &left, const T &right) {
+  if (left.dim() == 0)
+    throw TensorOpError("Left operand has dimension zero.");
+
+  Tensor<T> resp(left.shape());
+  auto *resp_data = resp.data();
+  if (left.is_contiguous()) {
+    detail::elementwise(detail::ElementOp::MULTIPLY, left.data(), right, resp_data, resp.dim());
+    return resp;
+  }
+  left.for_each([resp_data, right](size_t i, const T &value) {
+    resp_data[i] = static_cast<T>(value * right);
+  });
+
+  return resp;
+}
+
+template <typename T>
+T TensorOp<T>::inner(const TensorView<T> &left, const TensorView<T> &right) {
+  if (left.dim() == 0 || right.dim() == 0)
+    throw TensorOpError("One of the operands has dimension zero.");
+
+  if (left.dim() != right.dim())
+    throw TensorOpError("Operands are incompatible.");
+
+  T resp = 0.0;
+  if (right.is_contiguous()) {
+    auto r_data = right.data();
+    left.for_each([&resp, r_data](size_t i, const T &value) { resp += value * r_data[i]; });
+  } else if (left.is_contiguous()) {
+    auto l_data = left.data();
+    right.for_each([&resp, l_data](size_t i, const T &value) { resp += l_data[i] * value; });
+  } else {
+    auto r_tensor = right.to_tensor();
+    auto r_data = r_tensor.data();
+    left.for_each([&resp, r_data](size_t i, const T &value) { resp += value * r_data[i]; });
+  }
+
+  return resp;
+}
+
 template <typename T>
 Tensor<T> TensorOp<T>::product_tensors(const Tensor<T> &left, const Tensor<T> &right) {
 
@@ -309,8 +418,17 @@ Tensor<T> TensorOp<T>::product_tensors(const Tensor<T> &left, const Tensor<T> &r
   if (left.shape().axis_dim(1) != right.shape().axis_dim(0))
     throw TensorOpError("Operands are incompatible.");
 
+  auto m = detail::to_size_t(left.shape().axis_dim(0));
+  auto k = detail::to_size_t(left.shape().axis_dim(1));
+  auto n = detail::to_size_t(right.shape().axis_dim(1));
+  if (detail::use_native_gemm<T>(m, n, k)) {
+    Tensor<T> resp({m, n});
+    detail::gemm(false, false, m, n, k, left.data(), right.data(), resp.data());
+    return resp;
+  }
+
   auto aux = detail::TensorHelper::ope_tensors<T>(
-      *left._impl->tf_tensor, *right._impl->tf_tensor,
+      *left._impl->tf_tensor, *right._impl->tf_tensor, "MatMul",
       [](const tf::Scope &scope, tf::Input left, tf::Input right) {
         return tf::ops::MatMul(scope, left, right);
       });
@@ -108,31 +108,34 @@ Tensor<T> &TensorPart<T>::increase_dimension_by(Tensor<T> &tensor, size_t axis,
 }
 
 template <typename T>
-Matrix<T> TensorPart<T>::sub_matrix_cols(const Matrix<T> &matrix, const std::vector<size_t> &cols) {
+Matrix<T> TensorPart<T>::sub_matrix_cols(const TensorView<T> &matrix,
+                                         const std::vector<size_t> &cols) {
+  if (matrix.order() != 2)
+    throw MatrixError("Tensor does not have order two.");
   if (cols.empty())
     throw MatrixError("Column indexes vector cannot be empty.");
+  auto col_size = detail::to_size_t(matrix.shape().axis_dim(1));
   for (auto &item : cols)
-    if (item >= matrix.col_size())
+    if (item >= col_size)
       throw MatrixError("Inconsistent column indexes");
 
-  Matrix<T> resp{matrix.row_size(), cols.size()};
-  for (size_t i{0}; i < matrix.row_size(); ++i)
-    for (size_t j{0}; j < cols.size(); ++j)
-      resp(i, j) = matrix(i, cols[j]);
-  return resp;
+  return matrix.cols(cols).to_matrix();
 }
 
 template <typename T>
-txeo::Matrix<T> TensorPart<T>::sub_matrix_cols_exclude(const txeo::Matrix<T> &matrix,
+txeo::Matrix<T> TensorPart<T>::sub_matrix_cols_exclude(const txeo::TensorView<T> &matrix,
                                                        const std::vector<size_t> &cols) {
+  if (matrix.order() != 2)
+    throw MatrixError("Tensor does not have order two.");
   if (cols.empty())
     throw MatrixError("Column indexes vector cannot be empty.");
+  auto col_size = detail::to_size_t(matrix.shape().axis_dim(1));
   for (auto &item : cols)
-    if (item >= matrix.col_size())
+    if (item >= col_size)
       throw MatrixError("Inconsistent column indexes");
 
   std::vector<size_t> in_cols;
-  for (size_t i{0}; i < matrix.col_size(); ++i) {
+  for (size_t i{0}; i < col_size; ++i) {
     if (std::ranges::find(cols, i) == std::cend(cols))
       in_cols.emplace_back(i);
   }
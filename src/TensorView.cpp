@@ -0,0 +1,133 @@
+#include "txeo/TensorView.h"
+#include "txeo/detail/utils.h"
+
+#include <utility>
+
+namespace txeo {
+
+template <typename T>
+void TensorView<T>::set_dims(std::vector<size_t> &&dims) {
+  _dim = 1;
+  for (auto &item : dims)
+    _dim *= item;
+  _shape = TensorShape(dims);
+  _dims = std::move(dims);
+}
+
+template <typename T>
+TensorView<T>::TensorView(const Tensor<T> &tensor) : _data{tensor.data()} {
+  auto &shape = tensor.shape();
+  _strides = shape.stride();
+  if (tensor.order() > 0)
+    _strides.emplace_back(1);
+  _offsets.resize(_strides.size());
+  this->set_dims(detail::to_size_t(shape.axes_dims()));
+}
+
+template <typename T>
+TensorView<T>::TensorView(const T *data, const TensorShape &shape) : _data{data} {
+  _strides = shape.stride();
+  if (shape.number_of_axes() > 0)
+    _strides.emplace_back(1);
+  _offsets.resize(_strides.size());
+  this->set_dims(detail::to_size_t(shape.axes_dims()));
+}
+
+template <typename T>
+TensorView<T>::TensorView(const T *data, const TensorShape &shape, std::vector<size_t> strides)
+    : _data{data}, _strides{std::move(strides)} {
+  if (_strides.size() != detail::to_size_t(shape.number_of_axes()))
+    throw TensorViewError("The number of strides and the number of axes do not match.");
+  _offsets.resize(_strides.size());
+  this->set_dims(detail::to_size_t(shape.axes_dims()));
+}
+
+template <typename T>
+bool TensorView<T>::is_contiguous() const {
+  size_t expected{1};
+  for (size_t i{_dims.size()}; i > 0; --i) {
+    if (!_offsets[i - 1].empty() || (_dims[i - 1] > 1 && _strides[i - 1] != expected))
+      return false;
+    expected *= _dims[i - 1];
+  }
+  return true;
+}
+
+template <typename T>
+TensorView<T> TensorView<T>::slice(size_t axis, size_t first, size_t last, size_t step) const {
+  if (axis >= this->order())
+    throw TensorViewError("Inconsistent axis.");
+  if (first > last || last > _dims[axis])
+    throw TensorViewError("Inconsistent index range.");
+  if (step == 0)
+    throw TensorViewError("Step must be positive.");
+
+  TensorView<T> resp{*this};
+  auto dims = _dims;
+  dims[axis] = (last - first + step - 1) / step;
+  if (_offsets[axis].empty()) {
+    resp._data = _data + first * _strides[axis];
+    resp._strides[axis] = _strides[axis] * step;
+  } else {
+    resp._offsets[axis].clear();
+    for (size_t i{first}; i < last; i += step)
+      resp._offsets[axis].emplace_back(_offsets[axis][i]);
+  }
+  resp.set_dims(std::move(dims));
+
+  return resp;
+}
+
+template <typename T>
+TensorView<T> TensorView<T>::select(size_t axis, const std::vector<size_t> &indexes) const {
+  if (axis >= this->order())
+    throw TensorViewError("Inconsistent axis.");
+  if (indexes.empty())
+    throw TensorViewError("Indexes vector cannot be empty.");
+
+  TensorView<T> resp{*this};
+  auto &offsets = resp._offsets[axis];
+  offsets.clear();
+  offsets.reserve(indexes.size());
+  for (auto &item : indexes) {
+    if (item >= _dims[axis])
+      throw TensorViewError("Inconsistent indexes.");
+    offsets.emplace_back(this->axis_offset(axis, item));
+  }
+  auto dims = _dims;
+  dims[axis] = indexes.size();
+  resp.set_dims(std::move(dims));
+
+  return resp;
+}
+
+template <typename T>
+Tensor<T> TensorView<T>::to_tensor() const {
+  Tensor<T> resp{_shape};
+  auto *resp_data = resp.data();
+  this->for_each([resp_data](size_t i, const T &value) { resp_data[i] = value; });
+
+  return resp;
+}
+
+template <typename T>
+Matrix<T> TensorView<T>::to_matrix() const {
+  if (this->order() != 2)
+    throw TensorViewError("View is not a matrix.");
+  Matrix<T> resp{_dims[0], _dims[1]};
+  auto *resp_data = resp.data();
+  this->for_each([resp_data](size_t i, const T &value) { resp_data[i] = value; });
+
+  return resp;
+}
+
+template class TensorView<size_t>;
+template class TensorView<short>;
+template class TensorView<int>;
+template class TensorView<bool>;
+template class TensorView<long>;
+template class TensorView<long long>;
+template class TensorView<float>;
+template class TensorView<double>;
+
+} // namespace txeo
@@ -0,0 +1,141 @@
+#include "txeo/detail/TextParser.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace txeo::detail {
+
+LineReader::LineReader(const std::filesystem::path &path, size_t block_bytes)
+    : _file{path, std::ios::in | std::ios::binary}, _buffer(block_bytes) {
+}
+
+bool LineReader::next_line(std::string_view &line) {
+  while (true) {
+    auto *begin = _buffer.data() + _begin;
+    auto *newline = static_cast<const char *>(std::memchr(begin, '\n', _end - _begin));
+    if (newline == nullptr && _eof && _begin == _end)
+      return false;
+    if (newline != nullptr || _eof) {
+      auto *end = newline != nullptr ? newline : _buffer.data() + _end;
+      _begin = newline != nullptr ? static_cast<size_t>(newline - _buffer.data()) + 1 : _end;
+      if (end != begin && *(end - 1) == '\r')
+        --end;
+      line = std::string_view{begin, static_cast<size_t>(end - begin)};
+      return true;
+    }
+    this->fill();
+  }
+}
+
+void LineReader::fill() {
+  // The partial line left in the buffer moves to the front; a line longer than the buffer grows it
+  std::memmove(_buffer.data(), _buffer.data() + _begin, _end - _begin);
+  _end -= _begin;
+  _begin = 0;
+  if (_end == _buffer.size())
+    _buffer.resize(_buffer.size() * 2);
+
+  _file.read(_buffer.data() + _end, static_cast<std::streamsize>(_buffer.size() - _end));
+  auto n_read = static_cast<size_t>(_file.gcount());
+  _end += n_read;
+  if (n_read == 0 || _file.eof())
+    _eof = true;
+}
+
+MappedFile::MappedFile(const std::filesystem::path &path) {
+  auto fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return;
+
+  struct stat info{};
+  if (::fstat(fd, &info) == 0) {
+    _size = static_cast<size_t>(info.st_size);
+    if (_size == 0)
+      _open = true;
+    else {
+      _data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+      _open = _data != MAP_FAILED;
+      if (!_open)
+        _data = nullptr;
+    }
+  }
+  ::close(fd);
+}
+
+MappedFile::~MappedFile() {
+  if (_data != nullptr)
+    ::munmap(_data, _size);
+}
+
+bool pop_line(std::string_view &text, std::string_view &line) {
+  if (text.empty())
+    return false;
+  auto end = text.find('\n');
+  line = text.substr(0, end);
+  text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+  if (!line.empty() && line.back() == '\r')
+    line.remove_suffix(1);
+  return true;
+}
+
+std::vector<std::string_view> split_lines(std::string_view text, size_t max_parts,
+                                          size_t min_part_bytes) {
+  auto n_parts = std::clamp(text.size() / std::max(min_part_bytes, size_t{1}), size_t{1},
+                            std::max(max_parts, size_t{1}));
+
+  std::vector<std::string_view> resp;
+  resp.reserve(n_parts);
+  size_t begin{0};
+  for (size_t i{1}; i < n_parts; ++i) {
+    auto target = text.size() / n_parts * i;
+    if (target < begin)
+      continue;
+    auto newline = text.find('\n', target);
+    if (newline == std::string_view::npos)
+      break;
+    resp.emplace_back(text.substr(begin, newline + 1 - begin));
+    begin = newline + 1;
+  }
+  if (begin < text.size())
+    resp.emplace_back(text.substr(begin));
+
+  return resp;
+}
+
+bool parse_number(std::string_view field, double &value) {
+  auto is_blank = [](char c) { return c == ' ' || c == '\t' || c == '\r'; };
+  while (!field.empty() && is_blank(field.front()))
+    field.remove_prefix(1);
+  while (!field.empty() && is_blank(field.back()))
+    field.remove_suffix(1);
+  // from_chars rejects a leading plus sign, which is dropped only when a digit or a point
+  // follows it, so "+-3" is still rejected
+  if (field.size() > 1 && field[0] == '+' &&
+      (std::isdigit(static_cast<unsigned char>(field[1])) != 0 || field[1] == '.'))
+    field.remove_prefix(1);
+
+  auto *last = field.data() + field.size();
+  auto [ptr, ec] = std::from_chars(field.data(), last, value);
+  return ec == std::errc{} && ptr == last;
+}
+
+size_t count_fields(std::string_view line, char separator) {
+  size_t n_fields{0};
+  size_t pos{0};
+  while (true) {
+    auto end = line.find(separator, pos);
+    ++n_fields;
+    if (end == std::string_view::npos || end + 1 == line.size())
+      return n_fields;
+    pos = end + 1;
+  }
+}
+
+} // namespace txeo::detail
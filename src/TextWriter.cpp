@@ -0,0 +1,92 @@
+#include "txeo/detail/TextWriter.h"
+#include "txeo/detail/ThreadPool.h"
+
+#include <algorithm>
+#include <charconv>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace txeo::detail {
+
+namespace {
+
+// Text formatted per task; a wave of tasks is written before the next one starts
+constexpr size_t block_bytes{size_t{1} << 20};
+
+// Minimum number of elements worth formatting on several threads
+constexpr size_t parallel_min_elements{size_t{1} << 16};
+
+// Longest fixed notation of a double is 309 integral digits, a sign and a point
+constexpr size_t max_fixed_chars{312};
+
+template <typename T>
+void append_rows(std::string &block, std::vector<char> &scratch, const T *data, size_t n_cols,
+                 size_t row_begin, size_t row_end, size_t n_rows, char separator,
+                 int precision) {
+  auto *first = scratch.data();
+  auto *last = first + scratch.size();
+  for (auto i{row_begin}; i < row_end; ++i) {
+    const auto *row = data + i * n_cols;
+    for (size_t j{0}; j < n_cols; ++j) {
+      if (j != 0)
+        block += separator;
+      std::to_chars_result res{};
+      if constexpr (std::is_same_v<T, bool>)
+        res = std::to_chars(first, last, static_cast<int>(row[j]));
+      else if constexpr (std::is_floating_point_v<T>)
+        res = precision < 0 ? std::to_chars(first, last, row[j])
+                            : std::to_chars(first, last, row[j], std::chars_format::fixed,
+                                            precision);
+      else
+        res = std::to_chars(first, last, row[j]);
+      block.append(first, res.ptr);
+    }
+    if (i + 1 < n_rows)
+      block += '\n';
+  }
+}
+
+} // namespace
+
+template <typename T>
+void write_text(std::ostream &os, const T *data, size_t n_rows, size_t n_cols, char separator,
+                int precision) {
+  if (n_rows == 0 || n_cols == 0)
+    return;
+
+  auto rows_per_block = std::max(block_bytes / (n_cols * 16), size_t{1});
+  auto n_blocks = (n_rows + rows_per_block - 1) / rows_per_block;
+  auto &pool = ThreadPool::instance();
+  auto wave_size = n_rows * n_cols < parallel_min_elements ? size_t{1} : pool.size();
+  wave_size = std::min(wave_size, n_blocks);
+
+  std::vector<std::string> blocks(wave_size);
+  auto scratch_size = max_fixed_chars + static_cast<size_t>(std::max(precision, 0));
+  for (size_t wave{0}; wave < n_blocks; wave += wave_size) {
+    auto n_tasks = std::min(wave_size, n_blocks - wave);
+    pool.parallel_for(n_tasks, 1, [&](size_t begin, size_t end) {
+      std::vector<char> scratch(scratch_size);
+      for (auto b{begin}; b < end; ++b) {
+        auto row_begin = (wave + b) * rows_per_block;
+        auto row_end = std::min(row_begin + rows_per_block, n_rows);
+        blocks[b].clear();
+        append_rows(blocks[b], scratch, data, n_cols, row_begin, row_end, n_rows, separator,
+                    precision);
+      }
+    });
+    for (size_t b{0}; b < n_tasks; ++b)
+      os.write(blocks[b].data(), static_cast<std::streamsize>(blocks[b].size()));
+  }
+}
+
+template void write_text(std::ostream &, const short *, size_t, size_t, char, int);
+template void write_text(std::ostream &, const int *, size_t, size_t, char, int);
+template void write_text(std::ostream &, const bool *, size_t, size_t, char, int);
+template void write_text(std::ostream &, const long *, size_t, size_t, char, int);
+template void write_text(std::ostream &, const long long *, size_t, size_t, char, int);
+template void write_text(std::ostream &, const float *, size_t, size_t, char, int);
+template void write_text(std::ostream &, const double *, size_t, size_t, char, int);
+template void write_text(std::ostream &, const size_t *, size_t, size_t, char, int);
+
+} // namespace txeo::detail
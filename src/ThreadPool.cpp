@@ -0,0 +1,103 @@
+#include "txeo/detail/ThreadPool.h"
+
+#include <algorithm>
+#include <exception>
+#include <latch>
+#include <utility>
+
+namespace txeo::detail {
+
+namespace {
+
+thread_local bool is_worker{false};
+
+} // namespace
+
+ThreadPool::ThreadPool(size_t num_workers) {
+  _workers.reserve(num_workers);
+  for (size_t i{0}; i < num_workers; ++i)
+    _workers.emplace_back([this]() { this->work(); });
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lg{_mutex};
+    _stop = true;
+  }
+  _cv.notify_all();
+  for (auto &item : _workers)
+    item.join();
+}
+
+ThreadPool &ThreadPool::instance() {
+  static ThreadPool pool{std::max(std::thread::hardware_concurrency(), 1u) - 1};
+  return pool;
+}
+
+void ThreadPool::work() {
+  is_worker = true;
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock{_mutex};
+      _cv.wait(lock, [this]() { return _stop || !_tasks.empty(); });
+      if (_stop && _tasks.empty())
+        return;
+      task = std::move(_tasks.front());
+      _tasks.pop();
+    }
+    task();
+  }
+}
+
+void ThreadPool::parallel_for(size_t n, size_t grain,
+                              const std::function<void(size_t, size_t)> &func,
+                              size_t max_threads) {
+  if (n == 0)
+    return;
+
+  auto threads = max_threads == 0 ? this->size() : std::min(max_threads, this->size());
+  auto chunks = std::min(threads, std::max<size_t>(n / std::max<size_t>(grain, 1), 1));
+  if (chunks <= 1 || is_worker) {
+    func(0, n);
+    return;
+  }
+
+  auto chunk_size = (n + chunks - 1) / chunks;
+  chunks = (n + chunk_size - 1) / chunk_size;
+
+  std::latch done{static_cast<std::ptrdiff_t>(chunks - 1)};
+  std::exception_ptr error{nullptr};
+  std::mutex error_mutex;
+
+  auto run = [&](size_t begin, size_t end) {
+    try {
+      func(begin, end);
+    } catch (...) {
+      std::lock_guard<std::mutex> lg{error_mutex};
+      if (!error)
+        error = std::current_exception();
+    }
+  };
+
+  {
+    std::lock_guard<std::mutex> lg{_mutex};
+    for (size_t c{1}; c < chunks; ++c) {
+      auto begin = c * chunk_size;
+      auto end = std::min(begin + chunk_size, n);
+      _tasks.emplace([&run, &done, begin, end]() {
+        run(begin, end);
+        done.count_down();
+      });
+    }
+  }
+  _cv.notify_all();
+
+  run(0, std::min(chunk_size, n));
+  done.wait();
+
+  if (error)
+    std::rethrow_exception(error);
+}
+
+} // namespace txeo::detail
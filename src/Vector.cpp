@@ -15,7 +15,7 @@ Vector<T>::Vector() {
 
 template <typename T>
 Vector<T>::Vector(Tensor<T> &&tensor) : Tensor<T>(std::move(tensor)) {
-  if (tensor.order() != 1)
+  if (this->order() != 1)
     throw VectorError("Tensor does not have order one.");
 }
 
@@ -1,5 +1,8 @@
 #include "txeo/DataTable.h"
 #include "txeo/Matrix.h"
+#include "txeo/MatrixIO.h"
+
+#include <filesystem>
 #include <gtest/gtest.h>
 
 TEST(DataTableTest, ConstructWithSpecifiedFeatureAndLabelColumns) {
@@ -78,4 +81,31 @@ TEST(DataTableTest, ConstructTrainingDataOnly) {
   txeo::DataTable<double> dt_simple(X_train, y_train);
 
   EXPECT_EQ(dt_simple.x_train().row_size(), 2);
-}
\ No newline at end of file
+}
+
+TEST(DataTableTest, FromColumnarFile) {
+  const std::string path = "data_table.txcol";
+  txeo::Matrix<double> data(10, 6);
+  for (size_t i{0}; i < 10; ++i)
+    for (size_t j{0}; j < 6; ++j)
+      data(i, j) = static_cast<double>(i * 10 + j);
+  txeo::MatrixIO::write_columnarfile(data, path);
+
+  auto dt = txeo::DataTable<double>::from_columnar_file(path, {4, 1}, {5});
+  EXPECT_EQ(dt.x_dim(), 2);
+  EXPECT_EQ(dt.y_dim(), 1);
+  EXPECT_EQ(dt.x_train()(3, 0), 34.0);
+  EXPECT_EQ(dt.x_train()(3, 1), 31.0);
+  EXPECT_EQ(dt.y_train()(9, 0), 95.0);
+  EXPECT_FALSE(dt.has_eval());
+
+  auto split = txeo::DataTable<double>::from_columnar_file(path, {0}, {2, 3}, 20, 10);
+  EXPECT_EQ(split.row_size(), 7);
+  EXPECT_EQ(split.x_eval()->row_size(), 2);
+  EXPECT_EQ(split.y_test()->col_size(), 2);
+  EXPECT_EQ((*split.y_test())(0, 1), 93.0);
+
+  EXPECT_THROW(txeo::DataTable<double>::from_columnar_file(path, {}, {5}), txeo::DataTableError);
+  EXPECT_THROW(txeo::DataTable<double>::from_columnar_file(path, {0}, {6}), txeo::MatrixIOError);
+  std::filesystem::remove(path);
+}
@@ -4,6 +4,7 @@
 #include <gtest/gtest.h>
 #include <iterator>
 #include <string>
+#include <vector>
 
 #include "txeo/Matrix.h"
 #include "txeo/MatrixIO.h"
@@ -77,6 +78,34 @@ TEST_F(MatrixIOTest, WritePrecision) {
   EXPECT_EQ(content, "1.235,2.346,3.457");
 }
 
+TEST_F(MatrixIOTest, WriteShortestRoundTrip) {
+  const std::string path = test_dir + "/shortest.csv";
+  const Matrix<float> original(2, 2, {1.1f, 2.5f, 100.0f, -0.125f});
+
+  MatrixIO::write_textfile(original, path);
+
+  std::ifstream file(path);
+  std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  EXPECT_EQ(content, "1.1,2.5\n100,-0.125");
+}
+
+TEST_F(MatrixIOTest, WriteLargeMatrix) {
+  const std::string path = test_dir + "/large.csv";
+  Matrix<double> original(40000, 4);
+  for (size_t i = 0; i < original.dim(); ++i)
+    original.data()[i] = 1.0 / static_cast<double>(i + 1);
+
+  MatrixIO io{path};
+  io.write_text_file(original);
+  auto loaded = io.read_text_file<double>();
+  EXPECT_TRUE(loaded == original);
+
+  io.write_text_file(original, 4);
+  loaded = io.read_text_file<double>();
+  EXPECT_DOUBLE_EQ(loaded(0, 1), 0.5);
+  EXPECT_DOUBLE_EQ(loaded(39999, 3), 0.0);
+}
+
 TEST_F(MatrixIOTest, FileNotFoundRead) {
   EXPECT_THROW(MatrixIO::read_textfile<int>("nonexistent.csv"), MatrixIOError);
 }
@@ -86,6 +115,10 @@ TEST_F(MatrixIOTest, InvalidDataFormat) {
   create_test_file(path, "1,2.5,three\n4,5,6");
 
   EXPECT_THROW(MatrixIO::read_textfile<int>(path), MatrixIOError);
+  for (const auto *field : {"+-3", "+", "++3", "3-", "1e"}) {
+    create_test_file(path, std::string{"1,"} + field + "\n4,5\n");
+    EXPECT_THROW(MatrixIO::read_textfile<double>(path), MatrixIOError) << field;
+  }
 }
 
 TEST_F(MatrixIOTest, EmptyFile) {
@@ -102,6 +135,106 @@ TEST_F(MatrixIOTest, InconsistentRowLength) {
   EXPECT_THROW(MatrixIO::read_textfile<int>(path), MatrixIOError);
 }
 
+TEST_F(MatrixIOTest, ReadIrregularFormatting) {
+  const std::string path = test_dir + "/irregular.csv";
+  create_test_file(path, "a,b,c\r\n1, 2.5 ,+3\r\n\n4,5e-1,6,\n");
+
+  auto matrix = MatrixIO::read_textfile<double>(path, ',', true);
+
+  EXPECT_EQ(matrix.shape(), TensorShape({2, 3}));
+  EXPECT_DOUBLE_EQ(matrix(0, 1), 2.5);
+  EXPECT_DOUBLE_EQ(matrix(0, 2), 3.0);
+  EXPECT_DOUBLE_EQ(matrix(1, 1), 0.5);
+}
+
+TEST_F(MatrixIOTest, InvalidElementLineNumber) {
+  const std::string path = test_dir + "/invalid_line.csv";
+  create_test_file(path, "1,2\n3,4\n\n5,6x\n");
+
+  try {
+    MatrixIO::read_textfile<int>(path);
+    FAIL() << "Expected MatrixIOError";
+  } catch (const MatrixIOError &e) {
+    EXPECT_STREQ(e.what(), "Invalid element at line 4");
+  }
+}
+
+TEST_F(MatrixIOTest, ParallelReadMatchesSequential) {
+  const std::string path = test_dir + "/parallel.csv";
+  std::string content{"x,y,z\n"};
+  for (size_t i = 0; i < 50000; ++i) {
+    content += std::to_string(i) + "," + std::to_string(i * 0.5) + "," + std::to_string(i % 7);
+    content += i % 1000 == 0 ? "\n\n" : "\n";
+  }
+  create_test_file(path, content);
+
+  MatrixIO io{path};
+  auto sequential = io.read_text_file<double>(true);
+  auto parallel = io.read_text_file<double>(true, 0);
+
+  EXPECT_EQ(parallel.shape(), TensorShape({50000, 3}));
+  EXPECT_TRUE(parallel == sequential);
+  EXPECT_DOUBLE_EQ(parallel(49999, 1), 49999 * 0.5);
+}
+
+TEST_F(MatrixIOTest, ParallelReadReportsFirstError) {
+  const std::string path = test_dir + "/parallel_invalid.csv";
+  std::string content;
+  for (size_t i = 0; i < 50000; ++i)
+    content += i == 30000 || i == 40000 ? "1,a\n" : "1,2\n";
+  create_test_file(path, content);
+
+  try {
+    MatrixIO::read_textfile<int>(path, ',', false, 4);
+    FAIL() << "Expected MatrixIOError";
+  } catch (const MatrixIOError &e) {
+    EXPECT_STREQ(e.what(), "Invalid element at line 30001");
+  }
+
+  create_test_file(path, "");
+  EXPECT_THROW(MatrixIO::read_textfile<int>(path, ',', false, 4), MatrixIOError);
+  EXPECT_THROW(MatrixIO::read_textfile<int>("nonexistent.csv", ',', false, 4), MatrixIOError);
+}
+
+TEST_F(MatrixIOTest, StreamBatches) {
+  const std::string path = test_dir + "/batches.csv";
+  std::string content{"a,b\n"};
+  for (size_t i = 0; i < 10; ++i)
+    content += std::to_string(i) + "," + std::to_string(10 * i) + (i == 4 ? "\n\n" : "\n");
+  create_test_file(path, content);
+
+  for (bool prefetch : {false, true}) {
+    auto batches = MatrixIO{path}.stream_batches<int>(4, true, prefetch);
+    for (size_t pass = 0; pass < 2; ++pass) {
+      std::vector<size_t> rows;
+      int first{-1};
+      for (const auto &batch : batches) {
+        if (first < 0)
+          first = batch(0, 1);
+        rows.emplace_back(batch.row_size());
+        EXPECT_EQ(batch.col_size(), 2);
+      }
+      EXPECT_EQ(rows, std::vector<size_t>({4, 4, 2}));
+      EXPECT_EQ(first, 0);
+      EXPECT_EQ(batches.batch().data()[3], 90);
+    }
+  }
+}
+
+TEST_F(MatrixIOTest, StreamBatchesErrors) {
+  const std::string path = test_dir + "/batches_invalid.csv";
+  create_test_file(path, "1,2\n3,4\n5,x\n");
+
+  auto batches = MatrixIO{path}.stream_batches<int>(2, false, true);
+  EXPECT_EQ(batches.col_size(), 2);
+  auto it = batches.begin();
+  EXPECT_EQ((*it)(1, 0), 3);
+  EXPECT_THROW(++it, MatrixIOError);
+
+  EXPECT_THROW(MatrixIO{path}.stream_batches<int>(0), MatrixIOError);
+  EXPECT_THROW(MatrixIO{"nonexistent.csv"}.stream_batches<int>(2), MatrixIOError);
+}
+
 TEST_F(MatrixIOTest, FloatingPointRequires) {
   const Matrix<float> float_tensor(2, 2);
 
@@ -115,8 +248,18 @@ TEST_F(MatrixIOTest, OneHotEncode) {
   auto matrix = io.read_text_file<float>(true);
 
   EXPECT_EQ(matrix.dim(), 55);
-  EXPECT_EQ(matrix(3, 1), 1.0f);
+  EXPECT_EQ(matrix(3, 1), 0.0f);
+  EXPECT_EQ(matrix(3, 2), 1.0f);
   EXPECT_EQ(matrix(4, 9), 0.0f);
+
+  std::ifstream file(output_path);
+  std::string header;
+  std::getline(file, header);
+  EXPECT_EQ(header, "age,sex_female,sex_male,bmi,children,smoker_no,smoker_yes,region_northwest,"
+                    "region_southeast,region_southwest,charges");
+
+  auto encoded = MatrixIO::one_hot_encode_matrix<float>(input_path, ',', true);
+  EXPECT_TRUE(encoded == matrix);
   EXPECT_THROW(MatrixIO::one_hot_encode_text_file("nofile.txt", ',', true, output_path),
                MatrixIOError);
 
@@ -126,5 +269,93 @@ TEST_F(MatrixIOTest, OneHotEncode) {
   EXPECT_THROW(MatrixIO::one_hot_encode_text_file(path, ',', false, output_path), MatrixIOError);
 }
 
+TEST_F(MatrixIOTest, OneHotEncodeWithoutHeader) {
+  const std::string path = test_dir + "/categories.csv";
+  const std::string output_path = test_dir + "/categories_one_hot.csv";
+  create_test_file(path, "c;1.5;x\na;2;y\n\nb;3;x\n");
+
+  MatrixIO::one_hot_encode_text_file(path, ';', false, output_path);
+  std::ifstream file(output_path);
+  std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  EXPECT_EQ(content, "col_0_a;col_0_b;col_0_c;col_1;col_2_x;col_2_y\n"
+                     "0;0;1;1.5;1;0\n1;0;0;2;0;1\n0;1;0;3;1;0\n");
+
+  auto encoded = MatrixIO::one_hot_encode_matrix<int>(path, ';', false);
+  EXPECT_TRUE(encoded == Matrix<int>(3, 6, {0, 0, 1, 1, 1, 0, 1, 0, 0, 2, 0, 1, 0, 1, 0, 3, 1, 0}));
+
+  create_test_file(path, "a,1\n2,3\n");
+  EXPECT_THROW(MatrixIO::one_hot_encode_matrix<int>(path, ',', false), MatrixIOError);
+
+  // NaN and infinity markers next to text are categories, and make a numeric column mixed
+  create_test_file(path, "red,1\nnan,2\nblue,3\n");
+  auto markers = MatrixIO::one_hot_encode_matrix<int>(path, ',', false);
+  EXPECT_TRUE(markers == Matrix<int>(3, 4, {0, 0, 1, 1, 0, 1, 0, 2, 1, 0, 0, 3}));
+  create_test_file(path, "1,inf\n2,3\n");
+  EXPECT_THROW(MatrixIO::one_hot_encode_matrix<int>(path, ',', false), MatrixIOError);
+}
+
+TEST_F(MatrixIOTest, ColumnarRoundTrip) {
+  const std::string path = test_dir + "/round_trip.txcol";
+  Matrix<long> integers(1000, 3);
+  Matrix<double> reals(1000, 2);
+  for (size_t i{0}; i < 1000; ++i) {
+    integers(i, 0) = static_cast<long>(i) * 7 - 3000;
+    integers(i, 1) = static_cast<long>(i % 5) - 2;
+    integers(i, 2) = 42;
+    reals(i, 0) = static_cast<double>(i) * 0.25;
+    reals(i, 1) = -1.0 / static_cast<double>(i + 1);
+  }
+
+  MatrixIO io{path};
+  io.write_columnar_file(integers);
+  EXPECT_LT(fs::file_size(path), integers.dim() * sizeof(long) / 4);
+  EXPECT_TRUE(io.read_columnar_file<long>() == integers);
+
+  MatrixIO::write_columnarfile(reals, path);
+  EXPECT_TRUE(MatrixIO::read_columnarfile<double>(path) == reals);
+
+  const Matrix<bool> flags(2, 2, {true, false, false, true});
+  io.write_columnar_file(flags);
+  EXPECT_TRUE(io.read_columnar_file<bool>() == flags);
+}
+
+TEST_F(MatrixIOTest, ColumnarProjection) {
+  const std::string path = test_dir + "/wide.txcol";
+  Matrix<float> wide(50, 200);
+  for (size_t i{0}; i < 50; ++i)
+    for (size_t j{0}; j < 200; ++j)
+      wide(i, j) = static_cast<float>(i * 1000 + j);
+
+  MatrixIO io{path};
+  io.write_columnar_file(wide);
+  EXPECT_EQ(io.columnar_file_shape(), std::make_pair(size_t{50}, size_t{200}));
+
+  auto projected = io.read_columnar_file<float>({199, 3, 3, 0, 120});
+  EXPECT_EQ(projected.row_size(), 50);
+  EXPECT_EQ(projected.col_size(), 5);
+  EXPECT_EQ(projected(0, 0), 199.0f);
+  EXPECT_EQ(projected(7, 1), 7003.0f);
+  EXPECT_EQ(projected(7, 2), 7003.0f);
+  EXPECT_EQ(projected(49, 3), 49000.0f);
+  EXPECT_EQ(projected(49, 4), 49120.0f);
+}
+
+TEST_F(MatrixIOTest, ColumnarErrors) {
+  const std::string path = test_dir + "/errors.txcol";
+  MatrixIO io{path};
+  EXPECT_THROW(io.read_columnar_file<int>(), MatrixIOError);
+
+  io.write_columnar_file(Matrix<int>(2, 2, {1, 2, 3, 4}));
+  EXPECT_THROW(io.read_columnar_file<float>(), MatrixIOError);
+  EXPECT_THROW(io.read_columnar_file<int>({2}), MatrixIOError);
+  EXPECT_THROW(io.read_columnar_file<int>(std::vector<size_t>{}), MatrixIOError);
+
+  fs::resize_file(path, fs::file_size(path) - 1);
+  EXPECT_THROW(io.read_columnar_file<int>(), MatrixIOError);
+
+  create_test_file(path, "1,2,3\n4,5,6\n");
+  EXPECT_THROW(io.read_columnar_file<int>(), MatrixIOError);
+}
+
 } // namespace
-} // namespace txeo
\ No newline at end of file
+} // namespace txeo
@@ -1,8 +1,15 @@
+#include <filesystem>
 #include <gtest/gtest.h>
+#include <string>
+#include <vector>
 
+#include "txeo/DataTable.h"
+#include "txeo/DataTableNorm.h"
 #include "txeo/Matrix.h"
+#include "txeo/MatrixIO.h"
 #include "txeo/OlsGDTrainer.h"
 #include "txeo/Tensor.h"
+#include "txeo/TensorAllocator.h"
 #include "txeo/TensorShape.h"
 #include "txeo/types.h"
 
@@ -23,6 +30,77 @@ TEST(OlsGDTrainerTest, PredictOutputDimensions) {
   ASSERT_EQ(result.order(), 2);
 }
 
+TEST(OlsGDTrainerTest, TrainFromBatches) {
+  // y = x1 + 2 x2 + 3
+  Matrix<double> data(6, 3,
+                      {1., 2., 8., 2., 1., 7., 3., 4., 14., 4., 3., 13., 5., 5., 18., 6., 2., 13.});
+  Matrix<double> x_train(6, 2, {1., 2., 2., 1., 3., 4., 4., 3., 5., 5., 6., 2.});
+  Matrix<double> y_train(6, 1, {8., 7., 14., 13., 18., 13.});
+  Matrix<double> x_eval(2, 2, {2., 2., 7., 1.});
+  Matrix<double> y_eval(2, 1, {9., 12.});
+  const std::string path = "ols_batches.csv";
+  MatrixIO::write_textfile(data, path);
+
+  OlsGDTrainer<double> in_memory(DataTable<double>(x_train, y_train, x_eval, y_eval));
+  in_memory.enable_variable_lr();
+  in_memory.fit(100, LossFunc::MSE);
+
+  auto batches = MatrixIO{path}.stream_batches<double>(4);
+  OlsGDTrainer<double> streamed(DataTable<double>(x_train, y_train, x_eval, y_eval));
+  streamed.set_train_batches(batches, {0, 1}, {2});
+  streamed.enable_variable_lr();
+  streamed.fit(100, LossFunc::MSE);
+
+  const auto &expected = in_memory.weight_bias();
+  const auto &wb = streamed.weight_bias();
+  for (size_t i = 0; i < 3; ++i)
+    EXPECT_NEAR(wb(i, 0), expected(i, 0), 1e-6);
+
+  EXPECT_THROW(streamed.set_train_batches(batches, {0}, {2}), OlsGDTrainerError);
+  EXPECT_THROW(streamed.set_train_batches(batches, {0, 3}, {2}), OlsGDTrainerError);
+  EXPECT_THROW(streamed.set_train_batches(batches, {0, 1}, {5}), OlsGDTrainerError);
+
+  OlsGDTrainer<double> no_eval(DataTable<double>(x_train, y_train));
+  EXPECT_THROW(no_eval.set_train_batches(batches, {0, 1}, {2}), OlsGDTrainerError);
+  std::filesystem::remove(path);
+}
+
+TEST(OlsGDTrainerTest, TrainFromBatchesNormalizesWithDataTable) {
+  Matrix<double> data(6, 3,
+                      {1., 2., 8., 2., 1., 7., 3., 4., 14., 4., 3., 13., 5., 5., 18., 6., 2., 13.});
+  Matrix<double> x_all(6, 2, {1., 2., 2., 1., 3., 4., 4., 3., 5., 5., 6., 2.});
+  Matrix<double> y_all(6, 1, {8., 7., 14., 13., 18., 13.});
+  Matrix<double> x_eval(2, 2, {2., 2., 7., 1.});
+  Matrix<double> y_eval(2, 1, {9., 12.});
+  const std::string path = "ols_batches_norm.csv";
+  MatrixIO::write_textfile(data, path);
+
+  // The data table holds only the first three rows, a sample narrower than the streamed data
+  Matrix<double> x_sample(3, 2, {1., 2., 2., 1., 3., 4.});
+  Matrix<double> y_sample(3, 1, {8., 7., 14.});
+  DataTable<double> sample(x_sample, y_sample, x_eval, y_eval);
+
+  auto batches = MatrixIO{path}.stream_batches<double>(4);
+  OlsGDTrainer<double> streamed(DataTable<double>(x_sample, y_sample, x_eval, y_eval));
+  streamed.set_train_batches(batches, {0, 1}, {2});
+  streamed.enable_feature_norm(NormalizationType::MIN_MAX);
+  streamed.enable_variable_lr();
+  streamed.fit(100, LossFunc::MSE);
+  std::filesystem::remove(path);
+
+  // Same training on all the rows, normalized beforehand with the parameters of the sample
+  DataTableNorm<double> sample_norm{sample, NormalizationType::MIN_MAX};
+  OlsGDTrainer<double> expected_trainer(DataTable<double>(
+      sample_norm.normalize(x_all), y_all, sample_norm.normalize(x_eval), y_eval));
+  expected_trainer.enable_variable_lr();
+  expected_trainer.fit(100, LossFunc::MSE);
+
+  const auto &expected = expected_trainer.weight_bias();
+  const auto &wb = streamed.weight_bias();
+  for (size_t i = 0; i < 3; ++i)
+    EXPECT_NEAR(wb(i, 0), expected(i, 0), 1e-6);
+}
+
 TEST(OlsGDTrainerTest, LearningRateConfiguration) {
   Matrix<double> x_train(3, 1, {1.0, 2.0, 3.0});
   Matrix<double> y_train(3, 1, {2.0, 4.0, 6.0});
@@ -75,6 +153,22 @@ TEST(OlsGDTrainerTest, ConvergenceDetection) {
   EXPECT_TRUE(trainer.is_trained());
 }
 
+TEST(OlsGDTrainerTest, ReleasesPooledBuffers) {
+  Matrix<double> x_train(3, 1, {1.0, 2.0, 3.0});
+  Matrix<double> y_train(3, 1, {2.0, 4.0, 6.0});
+  OlsGDTrainer<double> trainer(DataTable<double>(x_train, y_train));
+  trainer.fit(10, LossFunc::MSE);
+
+  // The temporaries of training are not left cached in the pool of this thread
+  auto &pool = PoolAllocator::instance();
+  auto reuses = pool.stats().reuses;
+  {
+    AllocatorScope scope{pool};
+    Matrix<double> gram(2, 2, 0.0);
+  }
+  EXPECT_EQ(pool.stats().reuses, reuses);
+}
+
 TEST(OlsGDTrainerTest, WeightUpdateDuringTraining) {
   Matrix<double> x_train(3, 1, {1.0, 2.0, 3.0});
   Matrix<double> y_train(3, 1, {2.0, 4.0, 6.0});
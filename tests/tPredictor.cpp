@@ -146,4 +146,111 @@ TEST_F(PredictorTest, EnableXLAForFloat) {
   predictor.enable_xla(false);
 }
 
+TEST_F(PredictorTest, CallablesMatchNamedFeeds) {
+  txeo::Predictor<float> predictor(TEST_MODEL_PATH);
+  Tensor<float> input({2, 11}, {0.5869565217391305, 0.24791498520312072, 0.4, 1.0, 0.0, 1.0, 0.0,
+                                1.0, 0.0, 0.0, 0.0, 0.5869565217391305, 0.24791498520312072, 0.4,
+                                1.0, 0.0, 1.0, 0.0, 1.0, 0.0, 0.0, 0.0});
+  Predictor<float>::TensorIdent inputs{{"serving_default_dense_8_input:0", input}};
+
+  auto bound = predictor.predict(input);
+  auto bound_batch = predictor.predict_batch(inputs);
+  predictor.enable_callables(false);
+  auto named = predictor.predict(input);
+  auto named_batch = predictor.predict_batch(inputs);
+
+  ASSERT_EQ(bound.shape(), TensorShape({2, 1}));
+  EXPECT_TRUE(bound == named);
+  EXPECT_TRUE(bound_batch[0] == named_batch[0]);
+  EXPECT_FLOAT_EQ(std::trunc(bound(1, 0)), 9418.0f);
+
+  predictor.enable_callables(true);
+  predictor.enable_xla(false);
+  EXPECT_EQ(predictor.get_input_metadata().size(), 1);
+  EXPECT_TRUE(predictor.predict(input) == bound);
+}
+
+TEST_F(PredictorTest, PredictOutputs) {
+  txeo::Predictor<float> predictor(TEST_MODEL_PATH);
+  std::vector<float> first{0.5869565217391305, 0.24791498520312072, 0.4, 1.0, 0.0, 1.0, 0.0,
+                           1.0, 0.0, 0.0, 0.0};
+  Predictor<float>::TensorIdent inputs{
+      {"serving_default_dense_8_input:0", Tensor<float>({1, 11}, first)}};
+
+  auto all = predictor.predict_outputs(inputs, {});
+  ASSERT_EQ(all.size(), predictor.get_output_metadata().size());
+  EXPECT_FLOAT_EQ(std::trunc(all[0](0, 0)), 9418.0f);
+
+  // Outputs of a previous call are rebound to the shape and values of the next one
+  std::vector<float> second{0.1, 0.9, 0.0, 0.0, 1.0, 0.0, 1.0, 0.0, 0.0, 1.0, 0.0};
+  auto other = predictor.predict_outputs(
+      {{"serving_default_dense_8_input:0", Tensor<float>({1, 11}, second)}},
+      {"StatefulPartitionedCall:0"});
+  std::vector<float> batch_values{first};
+  batch_values.insert(batch_values.end(), second.begin(), second.end());
+  batch_values.insert(batch_values.end(), second.begin(), second.end());
+  Predictor<float>::TensorIdent batch{
+      {"serving_default_dense_8_input:0", Tensor<float>({3, 11}, batch_values)}};
+
+  std::vector<Tensor<float>> outputs;
+  predictor.predict_outputs(inputs, {"StatefulPartitionedCall:0"}, outputs);
+  ASSERT_EQ(outputs.size(), 1);
+  EXPECT_TRUE(outputs[0] == all[0]);
+  predictor.predict_outputs(batch, {"StatefulPartitionedCall:0"}, outputs);
+  ASSERT_EQ(outputs.size(), 1);
+  EXPECT_EQ(outputs[0].shape(), TensorShape({3, 1}));
+  EXPECT_NEAR(outputs[0](0, 0), all[0](0, 0), 1e-2f);
+  EXPECT_NEAR(outputs[0](1, 0), other[0](0, 0), 1e-2f);
+  EXPECT_NEAR(outputs[0](2, 0), other[0](0, 0), 1e-2f);
+  EXPECT_NE(outputs[0](0, 0), outputs[0](1, 0));
+  predictor.predict_outputs(inputs, {"StatefulPartitionedCall:0"}, outputs);
+  ASSERT_EQ(outputs.size(), 1);
+  EXPECT_EQ(outputs[0].shape(), TensorShape({1, 1}));
+  EXPECT_TRUE(outputs[0] == all[0]);
+
+  EXPECT_THROW({ auto aux = predictor.predict_outputs(inputs, {"invalid_name"}); },
+               txeo::PredictorError);
+}
+
+TEST_F(PredictorTest, SessionConfig) {
+  PredictorConfig config{.intra_op_threads = 2,
+                         .inter_op_threads = 1,
+                         .shared_inter_op_pool = "txeo_test_pool",
+                         .cpu_affinity = {0},
+                         .constant_folding = false};
+  Predictor<float> first(TEST_MODEL_PATH, config);
+  Predictor<float> second(TEST_MODEL_PATH, config);
+  EXPECT_EQ(first.config().intra_op_threads, 2);
+  EXPECT_EQ(first.config().shared_inter_op_pool, "txeo_test_pool");
+
+  Tensor<float> input({1, 11}, {0.5869565217391305, 0.24791498520312072, 0.4, 1.0, 0.0, 1.0, 0.0,
+                                1.0, 0.0, 0.0, 0.0});
+  EXPECT_FLOAT_EQ(std::trunc(first.predict(input)(0, 0)), 9418.0f);
+  EXPECT_FLOAT_EQ(std::trunc(second.predict(input)(0, 0)), 9418.0f);
+
+  second.enable_xla(true);
+  EXPECT_TRUE(second.config().enable_xla);
+
+  config.use_per_session_threads = true;
+  EXPECT_THROW({ Predictor<float> aux(TEST_MODEL_PATH, config); }, PredictorError);
+}
+
+TEST_F(PredictorTest, Warmup) {
+  PredictorConfig config{.warmup_batch_sizes = {1, 4}, .warmup_runs = 1};
+  Predictor<float> predictor(TEST_MODEL_PATH, config);
+  EXPECT_EQ(predictor.config().warmup_batch_sizes, std::vector<size_t>({1, 4}));
+
+  EXPECT_NO_THROW(predictor.warmup());
+  EXPECT_NO_THROW(predictor.warmup({8, 16}, 3));
+  EXPECT_NO_THROW(predictor.warmup({}, 0));
+
+  Tensor<float> input({2, 11}, 0.5f);
+  EXPECT_NO_THROW(predictor.warmup_inputs({{"serving_default_dense_8_input:0", input}}));
+  EXPECT_THROW(predictor.warmup_inputs({{"invalid_name", input}}), PredictorError);
+
+  Tensor<float> row({1, 11}, {0.5869565217391305, 0.24791498520312072, 0.4, 1.0, 0.0, 1.0, 0.0,
+                              1.0, 0.0, 0.0, 0.0});
+  EXPECT_FLOAT_EQ(std::trunc(predictor.predict(row)(0, 0)), 9418.0f);
+}
+
 } // namespace txeo
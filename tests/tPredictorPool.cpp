@@ -0,0 +1,78 @@
+#include <cmath>
+#include <cstddef>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "txeo/PredictorPool.h"
+#include "txeo/Tensor.h"
+#include "txeo/TensorShape.h"
+#include "txeo/detail/MpmcQueue.h"
+
+namespace txeo {
+namespace {
+
+const std::filesystem::path TEST_MODEL_PATH = "../../../../tests/test_data/model_regression";
+
+TEST(PredictorPoolTest, ConcurrentPredictions) {
+  PredictorPool<float> pool{TEST_MODEL_PATH, 3, PredictorConfig{.intra_op_threads = 1}};
+  ASSERT_EQ(pool.size(), 3);
+  EXPECT_EQ(pool.replica(2).get_input_metadata()[0].second, TensorShape({0, 11}));
+
+  Tensor<float> input({1, 11}, {0.5869565217391305, 0.24791498520312072, 0.4, 1.0, 0.0, 1.0, 0.0,
+                                1.0, 0.0, 0.0, 0.0});
+  std::vector<std::thread> threads;
+  std::vector<float> results(64);
+  for (size_t t{0}; t < 8; ++t)
+    threads.emplace_back([&, t]() {
+      for (size_t i{t}; i < results.size(); i += 8)
+        results[i] = pool.predict(input)(0, 0);
+    });
+  for (auto &thread : threads)
+    thread.join();
+
+  for (auto result : results)
+    EXPECT_FLOAT_EQ(std::trunc(result), 9418.0f);
+
+  size_t calls{0};
+  for (const auto &stats : pool.replica_stats()) {
+    calls += stats.calls;
+    EXPECT_GE(stats.utilization, 0.0);
+    EXPECT_LE(stats.utilization, 1.0);
+  }
+  EXPECT_EQ(calls, results.size());
+
+  auto outputs = pool.predict_outputs({{"serving_default_dense_8_input:0", input}}, {});
+  EXPECT_FLOAT_EQ(std::trunc(outputs[0](0, 0)), 9418.0f);
+}
+
+TEST(PredictorPoolTest, InvalidArguments) {
+  EXPECT_THROW({ PredictorPool<float> pool(TEST_MODEL_PATH, 0); }, PredictorError);
+
+  PredictorPool<float> pool{TEST_MODEL_PATH, 1};
+  EXPECT_THROW({ [[maybe_unused]] const auto &aux = pool.replica(1); }, PredictorError);
+  EXPECT_THROW({ auto aux = pool.predict(Tensor<float>({1, 3})); }, PredictorError);
+
+  // The replica is given back after a failed call
+  EXPECT_EQ(pool.replica_stats()[0].calls, 1);
+  EXPECT_THROW({ auto aux = pool.predict(Tensor<float>({1, 3})); }, PredictorError);
+}
+
+TEST(PredictorPoolTest, IdleQueue) {
+  detail::MpmcQueue<size_t> queue{3};
+  ASSERT_EQ(queue.capacity(), 4);
+  for (size_t i{0}; i < 4; ++i)
+    EXPECT_TRUE(queue.push(i));
+  EXPECT_FALSE(queue.push(4));
+
+  size_t value{0};
+  for (size_t i{0}; i < 4; ++i) {
+    ASSERT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(queue.pop(value));
+}
+
+} // namespace
+} // namespace txeo
@@ -0,0 +1,62 @@
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <future>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "txeo/Predictor.h"
+#include "txeo/PredictorQueue.h"
+#include "txeo/Tensor.h"
+#include "txeo/TensorShape.h"
+
+namespace txeo {
+namespace {
+
+const std::filesystem::path TEST_MODEL_PATH = "../../../../tests/test_data/model_regression";
+
+const std::vector<float> features{0.5869565217391305, 0.24791498520312072, 0.4, 1.0, 0.0, 1.0,
+                                  0.0,                1.0,                 0.0, 0.0, 0.0};
+
+TEST(PredictorQueueTest, SingleRequest) {
+  Predictor<float> predictor(TEST_MODEL_PATH);
+  PredictorQueue<float> queue{predictor};
+
+  auto output = queue.submit(Tensor<float>({11}, features)).get();
+
+  ASSERT_EQ(output.shape(), TensorShape({1}));
+  EXPECT_FLOAT_EQ(std::trunc(output(0)), 9418.0f);
+}
+
+TEST(PredictorQueueTest, ConcurrentRequestsAreBatched) {
+  Predictor<float> predictor(TEST_MODEL_PATH);
+  PredictorQueue<float> queue{predictor, 16, std::chrono::milliseconds{50}};
+
+  std::vector<std::future<Tensor<float>>> futures(32);
+  std::vector<std::thread> threads;
+  for (size_t t{0}; t < 4; ++t)
+    threads.emplace_back([&, t]() {
+      for (size_t i{t}; i < futures.size(); i += 4)
+        futures[i] = queue.submit(Tensor<float>({11}, features));
+    });
+  for (auto &thread : threads)
+    thread.join();
+
+  for (auto &future : futures)
+    EXPECT_FLOAT_EQ(std::trunc(future.get()(0)), 9418.0f);
+  EXPECT_EQ(queue.request_count(), 32);
+  EXPECT_LT(queue.batch_count(), 32);
+}
+
+TEST(PredictorQueueTest, InvalidArguments) {
+  Predictor<float> predictor(TEST_MODEL_PATH);
+  EXPECT_THROW({ PredictorQueue<float> aux(predictor, 0); }, PredictorError);
+
+  PredictorQueue<float> queue{predictor};
+  EXPECT_THROW({ auto aux = queue.submit(Tensor<float>({1, 11})); }, PredictorError);
+  EXPECT_THROW({ auto aux = queue.submit(Tensor<float>({10})); }, PredictorError);
+}
+
+} // namespace
+} // namespace txeo
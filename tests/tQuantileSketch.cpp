@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "txeo/QuantileSketch.h"
+
+namespace txeo {
+
+TEST(QuantileSketchTest, ExactWhileSmall) {
+  QuantileSketch<int> sketch{16};
+  for (int i = 1; i <= 9; ++i)
+    sketch.insert(i);
+
+  EXPECT_EQ(sketch.count(), 9);
+  EXPECT_EQ(sketch.retained(), 9);
+  EXPECT_EQ(sketch.quantile(0.0), 1);
+  EXPECT_EQ(sketch.quantile(0.5), 5);
+  EXPECT_EQ(sketch.quantile(1.0), 9);
+}
+
+TEST(QuantileSketchTest, BoundedRankError) {
+  const size_t n{200000};
+  QuantileSketch<double> sketch{200};
+  QuantileSketch<double> left{200};
+  QuantileSketch<double> right{200};
+  for (size_t i{0}; i < n; ++i) {
+    // A permutation of 0, ..., n - 1
+    auto value = static_cast<double>((i * 7919) % n);
+    sketch.insert(value);
+    (i % 2 == 0 ? left : right).insert(value);
+  }
+  left.merge(right);
+
+  EXPECT_EQ(sketch.count(), n);
+  EXPECT_EQ(left.count(), n);
+  EXPECT_LT(sketch.retained(), 2000);
+  EXPECT_LT(left.retained(), 2000);
+
+  std::vector<double> qs{0.0, 0.01, 0.25, 0.5, 0.75, 0.99, 1.0};
+  auto values = sketch.quantiles(qs);
+  auto merged = left.quantiles(qs);
+  for (size_t i{0}; i < qs.size(); ++i) {
+    EXPECT_NEAR(values[i] / n, qs[i], 0.02);
+    EXPECT_NEAR(merged[i] / n, qs[i], 0.02);
+  }
+  EXPECT_DOUBLE_EQ(values.front(), 0.0);
+  EXPECT_DOUBLE_EQ(values.back(), n - 1.0);
+}
+
+TEST(QuantileSketchTest, Errors) {
+  EXPECT_THROW(QuantileSketch<int>{4}, QuantileSketchError);
+
+  QuantileSketch<int> sketch;
+  EXPECT_THROW([[maybe_unused]] auto aux = sketch.quantile(0.5), QuantileSketchError);
+  sketch.insert(1);
+  EXPECT_THROW([[maybe_unused]] auto aux = sketch.quantile(1.5), QuantileSketchError);
+
+  QuantileSketch<int> other{100};
+  EXPECT_THROW(sketch.merge(other), QuantileSketchError);
+}
+
+} // namespace txeo
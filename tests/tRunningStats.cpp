@@ -0,0 +1,67 @@
+#include <cmath>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "txeo/RunningStats.h"
+
+namespace txeo {
+
+TEST(RunningStatsTest, Moments) {
+  std::vector<double> values{2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0};
+  RunningStats<double> stats;
+  stats.push(values.data(), values.size());
+
+  EXPECT_EQ(stats.count(), 8);
+  EXPECT_DOUBLE_EQ(stats.mean(), 5.0);
+  EXPECT_DOUBLE_EQ(stats.sum(), 40.0);
+  EXPECT_DOUBLE_EQ(stats.population_variance(), 4.0);
+  EXPECT_DOUBLE_EQ(stats.population_standard_deviation(), 2.0);
+  EXPECT_DOUBLE_EQ(stats.variance(), 32.0 / 7.0);
+  EXPECT_DOUBLE_EQ(stats.min(), 2.0);
+  EXPECT_DOUBLE_EQ(stats.max(), 9.0);
+
+  RunningStats<double> single;
+  for (const auto &item : values)
+    single.push(item);
+  EXPECT_DOUBLE_EQ(single.mean(), 5.0);
+  EXPECT_DOUBLE_EQ(single.variance(), stats.variance());
+
+  RunningStats<double> empty;
+  EXPECT_EQ(empty.count(), 0);
+  EXPECT_DOUBLE_EQ(empty.variance(), 0.0);
+}
+
+TEST(RunningStatsTest, StridedAndMerged) {
+  std::vector<int> matrix{1, 10, 2, 20, 3, 30, 4, 40};
+  RunningStats<int> first_column;
+  RunningStats<int> second_column;
+  first_column.push(matrix.data(), 4, 2);
+  second_column.push(matrix.data() + 1, 4, 2);
+  EXPECT_EQ(first_column.max(), 4);
+  EXPECT_EQ(second_column.min(), 10);
+
+  RunningStats<int> both{first_column};
+  both.merge(second_column);
+  EXPECT_EQ(both.count(), 8);
+  EXPECT_EQ(both.min(), 1);
+  EXPECT_EQ(both.max(), 40);
+  EXPECT_EQ(both.mean(), 13);
+  EXPECT_EQ(both.sum(), 110);
+}
+
+TEST(RunningStatsTest, StableForLargeFloatSequences) {
+  // Values around a large offset, where naive float sums lose the deviations
+  const size_t n{1000000};
+  std::vector<float> values(n);
+  for (size_t i{0}; i < n; ++i)
+    values[i] = 10000.0f + static_cast<float>(i % 10);
+
+  RunningStats<float> stats;
+  stats.push(values.data(), n);
+  EXPECT_EQ(stats.count(), n);
+  EXPECT_NEAR(stats.mean(), 10004.5f, 1e-3f);
+  EXPECT_NEAR(stats.population_variance(), 8.25f, 1e-3f);
+}
+
+} // namespace txeo
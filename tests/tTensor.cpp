@@ -69,6 +69,24 @@ TEST(TensorTest, CopyConstructor) {
   EXPECT_EQ(copy(1, 1), 4);
 }
 
+TEST(TensorTest, CopyOnWrite) {
+  Tensor<int> original({{1, 2}, {3, 4}});
+  const Tensor<int> copy(original);
+  EXPECT_EQ(copy.data(), std::as_const(original).data());
+
+  original(0, 0) = 7;
+  EXPECT_NE(copy.data(), std::as_const(original).data());
+  EXPECT_EQ(copy(0, 0), 1);
+  EXPECT_EQ(original(0, 0), 7);
+
+  Tensor<int> assigned({{0}});
+  assigned = original;
+  auto *data = assigned.data();
+  data[3] = 9;
+  EXPECT_EQ(original(1, 1), 4);
+  EXPECT_EQ(assigned(1, 1), 9);
+}
+
 TEST(TensorTest, MoveConstructor) {
   Tensor<int> original({{1, 2}, {3, 4}});
   Tensor<int> moved(std::move(original));
@@ -1,15 +1,31 @@
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <gtest/gtest.h>
 #include <initializer_list>
+#include <limits>
+#include <numeric>
 #include <vector>
 
 #include "txeo/Tensor.h"
 #include "txeo/TensorAgg.h"
 #include "txeo/TensorShape.h"
+#include "txeo/detail/TensorHelper.h"
 
 namespace txeo {
 
+namespace {
+
+// Values that differ between neighbouring elements and repeat only every 1009 elements
+std::vector<double> varied_grid(size_t n, double scale = 1.0, double offset = 0.0) {
+  std::vector<double> grid(n);
+  for (size_t i{0}; i < n; ++i)
+    grid[i] = offset + scale * static_cast<double>((i * 37) % 1009);
+  return grid;
+}
+
+} // namespace
+
 TEST(TensorAggTest, ReduceSum) {
 
   Tensor<int> tensor1D({5}, {1, 2, 3, 4, 5});
@@ -36,6 +52,95 @@ TEST(TensorAggTest, ReduceSum) {
   EXPECT_EQ(result3D(1), 20);
 }
 
+TEST(TensorAggTest, CumulativeSumReusesGraph) {
+  detail::TensorHelper::clear_graph_cache();
+
+  Tensor<int> tensor1({2, 3}, {1, 2, 3, 4, 5, 6});
+  Tensor<int> tensor2({2, 3}, {6, 5, 4, 3, 2, 1});
+
+  auto result1 = TensorAgg<int>::cumulative_sum(tensor1, 1);
+  auto cache_size = detail::TensorHelper::graph_cache_size();
+  auto result2 = TensorAgg<int>::cumulative_sum(tensor2, 1);
+  EXPECT_EQ(detail::TensorHelper::graph_cache_size(), cache_size);
+  EXPECT_EQ(result1(0, 2), 6);
+  EXPECT_EQ(result1(1, 2), 15);
+  EXPECT_EQ(result2(0, 2), 15);
+  EXPECT_EQ(result2(1, 2), 6);
+
+  auto result3 = TensorAgg<int>::cumulative_sum(tensor1, 0);
+  EXPECT_EQ(detail::TensorHelper::graph_cache_size(), cache_size + 1);
+  EXPECT_EQ(result3(1, 0), 5);
+}
+
+TEST(TensorAggTest, NativeReductions) {
+  detail::TensorHelper::clear_graph_cache();
+
+  std::vector<int> values(24);
+  std::iota(values.begin(), values.end(), 0);
+  Tensor<int> tensor3D({2, 3, 4}, values);
+
+  auto sum = TensorAgg<int>::reduce_sum(tensor3D, {0, 2});
+  EXPECT_EQ(sum.shape(), TensorShape({3}));
+  EXPECT_EQ(sum(0), 60);
+  EXPECT_EQ(sum(1), 92);
+  EXPECT_EQ(sum(2), 124);
+
+  auto max = TensorAgg<int>::reduce_max(tensor3D, {1});
+  EXPECT_EQ(max.shape(), TensorShape({2, 4}));
+  EXPECT_EQ(max(0, 0), 8);
+  EXPECT_EQ(max(1, 3), 23);
+
+  auto min = TensorAgg<int>::reduce_min(tensor3D, {0, 1, 2});
+  EXPECT_EQ(min.shape(), TensorShape({}));
+  EXPECT_EQ(min(), 0);
+
+  auto same = TensorAgg<int>::reduce_sum(tensor3D, {});
+  EXPECT_TRUE(same == tensor3D);
+
+  Tensor<int> flags({2, 2}, {1, 0, 2, 3});
+  auto all = TensorAgg<int>::reduce_all(flags, {1});
+  EXPECT_EQ(all(0), 0);
+  EXPECT_EQ(all(1), 1);
+  EXPECT_EQ(detail::TensorHelper::graph_cache_size(), 0);
+
+  // Large enough to be split across threads. The values differ from row to row and from column
+  // to column, so a misplaced block or chunk changes the results compared with serial loops
+  auto grid = varied_grid(300 * 200);
+  Tensor<double> matrix({300, 200}, grid);
+  std::vector<double> row_sums(300, 0.0);
+  std::vector<double> col_sums(200, 0.0);
+  std::vector<double> col_max(200, 0.0);
+  double total_sum{0.0};
+  double total_squares{0.0};
+  for (size_t i{0}; i < 300; ++i) {
+    for (size_t j{0}; j < 200; ++j) {
+      auto value = grid[i * 200 + j];
+      row_sums[i] += value;
+      col_sums[j] += value;
+      col_max[j] = std::max(col_max[j], value);
+      total_sum += value;
+      total_squares += value * value;
+    }
+  }
+
+  auto rows = TensorAgg<double>::reduce_sum(matrix, {1});
+  auto cols = TensorAgg<double>::reduce_mean(matrix, {0});
+  auto cols_max = TensorAgg<double>::reduce_max(matrix, {0});
+  EXPECT_EQ(rows.shape(), TensorShape({300}));
+  EXPECT_EQ(cols.shape(), TensorShape({200}));
+  for (size_t i{0}; i < 300; ++i)
+    EXPECT_DOUBLE_EQ(rows(i), row_sums[i]);
+  for (size_t j{0}; j < 200; ++j) {
+    EXPECT_DOUBLE_EQ(cols(j), col_sums[j] / 300.0);
+    EXPECT_DOUBLE_EQ(cols_max(j), col_max[j]);
+  }
+
+  auto total = TensorAgg<double>::reduce_sum(matrix, {0, 1});
+  auto norm = TensorAgg<double>::reduce_euclidean_norm(matrix, {0, 1});
+  EXPECT_DOUBLE_EQ(total(), total_sum);
+  EXPECT_NEAR(norm(), std::sqrt(total_squares), 1e-6);
+}
+
 TEST(TensorAggTest, ReduceMean) {
 
   Tensor<int> tensor1D({5}, {1, 2, 3, 4, 5});
@@ -228,6 +333,12 @@ TEST(TensorAggTest, ReduceVariance) {
   EXPECT_EQ(result2D.shape().axes_dims(), std::vector<int64_t>({2}));
   EXPECT_NEAR(result2D(0), 1.0, 1e-6);
   EXPECT_NEAR(result2D(1), 1.0, 1e-6);
+
+  // Integral variances are computed around the exact mean and truncated once
+  txeo::Tensor<int> integers({2, 2}, {1, 2, 0, 3});
+  auto result_int = TensorAgg<int>::reduce_variance(integers, 1);
+  EXPECT_EQ(result_int(0), 0);
+  EXPECT_EQ(result_int(1), 4);
 }
 
 TEST(TensorAggTest, ReduceStandardDeviation) {
@@ -254,6 +365,51 @@ TEST(TensorAggTest, ReduceMedian) {
   EXPECT_EQ(result2D.shape().axes_dims(), std::vector<int64_t>({2}));
   EXPECT_EQ(result2D(0), 2);
   EXPECT_EQ(result2D(1), 5);
+
+  txeo::Tensor<double> even({2, 4}, {4., 1., 3., 2., 8., 6., 7., 5.});
+  auto result_even = TensorAgg<double>::reduce_median(even, 1);
+  EXPECT_DOUBLE_EQ(result_even(0), 2.5);
+  EXPECT_DOUBLE_EQ(result_even(1), 6.5);
+}
+
+TEST(TensorAggTest, ReduceQuantiles) {
+  Tensor<double> tensor({2, 5}, {5., 1., 4., 2., 3., 50., 40., 30., 20., 10.});
+  auto result = TensorAgg<double>::reduce_quantiles(tensor, 1, {0.5, 0.25, 1.0, 0.1});
+  EXPECT_EQ(result.shape(), TensorShape({2, 4}));
+  EXPECT_DOUBLE_EQ(result(0, 0), 3.0);
+  EXPECT_DOUBLE_EQ(result(0, 1), 2.0);
+  EXPECT_DOUBLE_EQ(result(0, 2), 5.0);
+  EXPECT_DOUBLE_EQ(result(0, 3), 1.4);
+  EXPECT_DOUBLE_EQ(result(1, 0), 30.0);
+  EXPECT_DOUBLE_EQ(result(1, 3), 14.0);
+
+  auto columns = TensorAgg<double>::reduce_quantiles(tensor, 0, {0.5});
+  EXPECT_EQ(columns.shape(), TensorShape({5, 1}));
+  EXPECT_DOUBLE_EQ(columns(1, 0), 20.5);
+
+  EXPECT_THROW(TensorAgg<double>::reduce_quantiles(tensor, 1, {}), TensorAggError);
+  EXPECT_THROW(TensorAgg<double>::reduce_quantiles(tensor, 1, {1.5}), TensorAggError);
+  EXPECT_THROW(TensorAgg<double>::reduce_quantiles(tensor, 2, {0.5}), TensorAggError);
+}
+
+TEST(TensorAggTest, ReduceQuantilesApprox) {
+  const size_t n{300000};
+  std::vector<double> values(n);
+  for (size_t i{0}; i < n; ++i)
+    values[i] = static_cast<double>((i * 7919) % n);
+  Tensor<double> column({n, 1}, values);
+
+  auto result = TensorAgg<double>::reduce_quantiles_approx(column, 0, {0.0, 0.5, 0.99, 1.0});
+  EXPECT_EQ(result.shape(), TensorShape({1, 4}));
+  EXPECT_DOUBLE_EQ(result(0, 0), 0.0);
+  EXPECT_NEAR(result(0, 1) / n, 0.5, 0.02);
+  EXPECT_NEAR(result(0, 2) / n, 0.99, 0.02);
+  EXPECT_DOUBLE_EQ(result(0, 3), n - 1.0);
+
+  Tensor<double> small({2, 3}, {3., 1., 2., 6., 5., 4.});
+  auto exact = TensorAgg<double>::reduce_quantiles_approx(small, 1, {0.5});
+  EXPECT_DOUBLE_EQ(exact(0, 0), 2.0);
+  EXPECT_DOUBLE_EQ(exact(1, 0), 5.0);
 }
 
 TEST(TensorAggTest, ReduceGeometricMean) {
@@ -269,6 +425,57 @@ TEST(TensorAggTest, ReduceGeometricMean) {
   EXPECT_NEAR(result2D(1), std::sqrt(3.0 * 4.0), 1e-6);
 }
 
+TEST(TensorAggTest, FiberReductions) {
+  std::vector<int> values(24);
+  std::iota(values.begin(), values.end(), 0);
+  Tensor<int> tensor3D({2, 3, 4}, values);
+
+  auto median = TensorAgg<int>::reduce_median(tensor3D, 1);
+  EXPECT_EQ(median.shape(), TensorShape({2, 4}));
+  EXPECT_EQ(median(0, 0), 4);
+  EXPECT_EQ(median(1, 3), 19);
+
+  auto norm = TensorAgg<int>::reduce_maximum_norm(tensor3D, 0);
+  EXPECT_EQ(norm.shape(), TensorShape({3, 4}));
+  EXPECT_EQ(norm(2, 3), 23);
+
+  auto non_zero = TensorAgg<int>::count_non_zero(tensor3D, 2);
+  EXPECT_EQ(non_zero.shape(), TensorShape({2, 3}));
+  EXPECT_EQ(non_zero(0, 0), 3);
+  EXPECT_EQ(non_zero(1, 2), 4);
+
+  // Large enough to be split across threads. Every fiber holds different values, which are
+  // compared with serial computations over the gathered fibers
+  auto grid = varied_grid(4000 * 50, 1e-5, 1.0);
+  Tensor<double> matrix({4000, 50}, grid);
+
+  auto variance = TensorAgg<double>::reduce_variance(matrix, 1);
+  EXPECT_EQ(variance.shape(), TensorShape({4000}));
+  for (size_t i{0}; i < 4000; ++i) {
+    std::vector<double> row(grid.begin() + i * 50, grid.begin() + (i + 1) * 50);
+    auto mean = std::accumulate(row.begin(), row.end(), 0.0) / 50.0;
+    double squares{0.0};
+    for (auto &item : row)
+      squares += (item - mean) * (item - mean);
+    EXPECT_NEAR(variance(i), squares / 49.0, 1e-12);
+  }
+
+  auto median = TensorAgg<double>::reduce_median(matrix, 0);
+  auto geometric = TensorAgg<double>::reduce_geometric_mean(matrix, 0);
+  EXPECT_EQ(median.shape(), TensorShape({50}));
+  for (size_t j{0}; j < 50; ++j) {
+    std::vector<double> column(4000);
+    double logs{0.0};
+    for (size_t i{0}; i < 4000; ++i) {
+      column[i] = grid[i * 50 + j];
+      logs += std::log(column[i]);
+    }
+    std::sort(column.begin(), column.end());
+    EXPECT_DOUBLE_EQ(median(j), (column[1999] + column[2000]) / 2);
+    EXPECT_NEAR(geometric(j), std::exp(logs / 4000.0), 1e-9);
+  }
+}
+
 TEST(TensorAggTest, CountNonZero) {
   txeo::Tensor<int> tensor1D({5}, {0, 1, 0, 2, 0});
   auto result1D = TensorAgg<int>::count_non_zero(tensor1D, 0);
@@ -282,6 +489,96 @@ TEST(TensorAggTest, CountNonZero) {
   EXPECT_EQ(result2D(1), 2);
 }
 
+TEST(TensorAggTest, Describe) {
+  Tensor<double> table({3, 2}, {1.0, 10.0, 2.0, 0.0, 3.0, 20.0});
+  auto columns = TensorAgg<double>::describe(table, 0);
+  EXPECT_EQ(columns.mean.shape(), TensorShape({2}));
+  EXPECT_DOUBLE_EQ(columns.min(0), 1.0);
+  EXPECT_DOUBLE_EQ(columns.max(1), 20.0);
+  EXPECT_DOUBLE_EQ(columns.sum(1), 30.0);
+  EXPECT_DOUBLE_EQ(columns.mean(0), 2.0);
+  EXPECT_DOUBLE_EQ(columns.variance(1), 100.0);
+  EXPECT_EQ(columns.non_zero(0), 3);
+  EXPECT_EQ(columns.non_zero(1), 2);
+  EXPECT_EQ(columns.nan(0), 0);
+
+  // NaN elements are counted and left out of the other statistics
+  auto nan = std::numeric_limits<double>::quiet_NaN();
+  Tensor<double> rows({2, 3}, {nan, 4.0, 6.0, nan, nan, nan});
+  auto result = TensorAgg<double>::describe(rows, 1);
+  EXPECT_EQ(result.nan(0), 1);
+  EXPECT_EQ(result.nan(1), 3);
+  EXPECT_DOUBLE_EQ(result.mean(0), 5.0);
+  EXPECT_DOUBLE_EQ(result.variance(0), 2.0);
+  EXPECT_DOUBLE_EQ(result.sum(1), 0.0);
+  EXPECT_TRUE(std::isnan(result.min(1)));
+  EXPECT_TRUE(std::isnan(result.max(1)));
+  EXPECT_TRUE(std::isnan(result.mean(1)));
+  EXPECT_TRUE(std::isnan(result.variance(1)));
+  EXPECT_EQ(result.non_zero(1), 3);
+
+  std::vector<int> values(24);
+  std::iota(values.begin(), values.end(), 0);
+  auto middle = TensorAgg<int>::describe(Tensor<int>({2, 3, 4}, values), 1);
+  EXPECT_EQ(middle.sum.shape(), TensorShape({2, 4}));
+  EXPECT_EQ(middle.sum(1, 3), 19 + 23 + 15);
+  EXPECT_EQ(middle.min(1, 0), 12);
+  EXPECT_EQ(middle.non_zero(0, 0), 2);
+
+  // A single value has no spread, while reduce_variance keeps its element on a length-1 axis
+  Tensor<double> single({1, 2}, {3.0, 7.0});
+  auto single_result = TensorAgg<double>::describe(single, 0);
+  EXPECT_DOUBLE_EQ(single_result.variance(0), 0.0);
+  EXPECT_DOUBLE_EQ(single_result.variance(1), 0.0);
+  auto legacy = TensorAgg<double>::reduce_variance(single, 0);
+  EXPECT_DOUBLE_EQ(legacy(0), 3.0);
+  EXPECT_DOUBLE_EQ(legacy(1), 7.0);
+
+  // Long columns split in segments, wide tables split in column tiles and contiguous rows, all
+  // large enough to be described in parallel. Values, zeros and NaN vary along every fiber and
+  // are compared with serial loops over the gathered fibers
+  auto check = [](size_t n_rows, size_t n_cols, size_t axis) {
+    auto grid = varied_grid(n_rows * n_cols);
+    for (size_t i{5}; i < grid.size(); i += 97)
+      grid[i] = std::numeric_limits<double>::quiet_NaN();
+    auto result = TensorAgg<double>::describe(Tensor<double>({n_rows, n_cols}, grid), axis);
+    auto n_fibers = axis == 0 ? n_cols : n_rows;
+    auto length = axis == 0 ? n_rows : n_cols;
+    for (size_t f{0}; f < n_fibers; ++f) {
+      std::vector<double> values;
+      size_t nan{0};
+      size_t non_zero{0};
+      for (size_t k{0}; k < length; ++k) {
+        auto value = axis == 0 ? grid[k * n_cols + f] : grid[f * n_cols + k];
+        non_zero += value != 0.0 ? 1 : 0;
+        if (std::isnan(value))
+          ++nan;
+        else
+          values.emplace_back(value);
+      }
+      auto sum = std::accumulate(values.begin(), values.end(), 0.0);
+      auto mean = sum / static_cast<double>(values.size());
+      double squares{0.0};
+      for (auto &item : values)
+        squares += (item - mean) * (item - mean);
+
+      EXPECT_EQ(result.nan(f), nan);
+      EXPECT_EQ(result.non_zero(f), non_zero);
+      EXPECT_DOUBLE_EQ(result.min(f), *std::ranges::min_element(values));
+      EXPECT_DOUBLE_EQ(result.max(f), *std::ranges::max_element(values));
+      EXPECT_DOUBLE_EQ(result.sum(f), sum);
+      EXPECT_NEAR(result.mean(f), mean, 1e-9 * mean);
+      EXPECT_NEAR(result.variance(f), squares / static_cast<double>(values.size() - 1),
+                  1e-9 * mean * mean);
+    }
+  };
+  check(140000, 3, 0);
+  check(3000, 130, 0);
+  check(130, 3000, 1);
+
+  EXPECT_THROW(TensorAgg<double>::describe(table, 2), TensorAggError);
+}
+
 TEST(TensorAggTest, SumAll) {
   txeo::Tensor<int> tensor1D({5}, {1, 2, 3, 4, 5});
   auto result1D = TensorAgg<int>::sum_all(tensor1D);
@@ -0,0 +1,75 @@
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <utility>
+
+#include "txeo/Matrix.h"
+#include "txeo/Tensor.h"
+#include "txeo/TensorAllocator.h"
+
+namespace txeo {
+
+TEST(TensorAllocatorTest, PoolRecyclesBuffers) {
+  auto &pool = PoolAllocator::instance();
+  auto before = pool.stats();
+  {
+    AllocatorScope scope{pool};
+    EXPECT_EQ(AllocatorScope::current(), &pool);
+    for (int i = 0; i < 10; ++i) {
+      Matrix<double> tmp(32, 32, 1.0);
+      EXPECT_EQ(reinterpret_cast<std::uintptr_t>(std::as_const(tmp).data()) % 64, 0);
+      EXPECT_DOUBLE_EQ(tmp(31, 31), 1.0);
+    }
+  }
+  EXPECT_EQ(AllocatorScope::current(), nullptr);
+
+  auto after = pool.stats();
+  EXPECT_EQ(after.allocations - before.allocations, 10);
+  EXPECT_EQ(after.deallocations - before.deallocations, 10);
+  EXPECT_GE(after.reuses - before.reuses, 9);
+  EXPECT_EQ(after.bytes_in_use, before.bytes_in_use);
+  EXPECT_GE(after.peak_bytes_in_use, 32 * 32 * sizeof(double));
+}
+
+TEST(TensorAllocatorTest, ScopesNest) {
+  TensorArena arena;
+  {
+    AllocatorScope outer{PoolAllocator::instance()};
+    {
+      AllocatorScope inner{arena};
+      EXPECT_EQ(AllocatorScope::current(), &arena);
+      Tensor<int> t({4}, 7);
+      EXPECT_EQ(arena.stats().bytes_in_use, 4 * sizeof(int));
+    }
+    EXPECT_EQ(AllocatorScope::current(), &PoolAllocator::instance());
+  }
+  EXPECT_EQ(arena.stats().allocations, 1);
+  EXPECT_EQ(arena.stats().deallocations, 1);
+}
+
+TEST(TensorAllocatorTest, ArenaRewindsWhenEmpty) {
+  TensorArena arena{1 << 16};
+  AllocatorScope scope{arena};
+  for (int i = 0; i < 100; ++i) {
+    Tensor<float> a({64, 64}, 1.0f);
+    Tensor<float> b({64, 64}, 2.0f);
+    EXPECT_FLOAT_EQ(a(0, 0) + b(63, 63), 3.0f);
+  }
+  EXPECT_EQ(arena.reserved_bytes(), 1 << 16);
+  EXPECT_EQ(arena.stats().allocations, 200);
+}
+
+TEST(TensorAllocatorTest, ArenaTensorsOutliveArena) {
+  Tensor<double> kept;
+  {
+    TensorArena arena;
+    AllocatorScope scope{arena};
+    Tensor<double> tmp({3}, 2.5);
+    kept = tmp;
+  }
+  EXPECT_DOUBLE_EQ(kept(2), 2.5);
+  kept(2) = 1.0;
+  EXPECT_DOUBLE_EQ(kept(2), 1.0);
+  EXPECT_THROW(TensorArena{0}, TensorAllocatorError);
+}
+
+} // namespace txeo
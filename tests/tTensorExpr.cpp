@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "txeo/Matrix.h"
+#include "txeo/Tensor.h"
+#include "txeo/TensorExpr.h"
+#include "txeo/TensorOp.h"
+#include "txeo/TensorShape.h"
+#include "txeo/Vector.h"
+
+namespace txeo {
+
+TEST(TensorExprTest, EvaluatesChainIntoTensor) {
+  Tensor<double> a({2, 2}, {1.0, 2.0, 3.0, 4.0});
+  Tensor<double> b({2, 2}, {4.0, 3.0, 2.0, 1.0});
+
+  Tensor<double> result = 2.0 * lazy(a) + b / 2.0 - 1.0;
+
+  EXPECT_EQ(result.shape(), TensorShape({2, 2}));
+  EXPECT_DOUBLE_EQ(result(0, 0), 3.0);
+  EXPECT_DOUBLE_EQ(result(0, 1), 4.5);
+  EXPECT_DOUBLE_EQ(result(1, 0), 6.0);
+  EXPECT_DOUBLE_EQ(result(1, 1), 7.5);
+}
+
+TEST(TensorExprTest, MatchesEagerOperators) {
+  Matrix<float> b(2, 3, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+  Matrix<float> k(2, 3, {0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f});
+  Matrix<float> z(3, 3, {1.0f, 0.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f, 0.0f, 3.0f});
+
+  Matrix<float> eager = b - (0.1f * (b.dot(z) - k));
+  Matrix<float> fused = b - 0.1f * (lazy(b.dot(z)) - k);
+
+  EXPECT_TRUE(fused == eager);
+}
+
+TEST(TensorExprTest, AssignsInPlace) {
+  Matrix<int> m(2, 2, {1, 2, 3, 4});
+  Matrix<int> other(2, 2, {10, 20, 30, 40});
+  auto *data = m.data();
+
+  m = lazy(other) - m;
+  EXPECT_EQ(m.data(), data);
+  EXPECT_TRUE(m == Matrix<int>(2, 2, {9, 18, 27, 36}));
+
+  m -= 2 * lazy(other);
+  EXPECT_TRUE(m == Matrix<int>(2, 2, {-11, -22, -33, -44}));
+
+  m += lazy(other) + 1;
+  EXPECT_TRUE(m == Matrix<int>(2, 2, {0, -1, -2, -3}));
+}
+
+TEST(TensorExprTest, ReshapesOnAssignment) {
+  Vector<double> v({1.0, 2.0, 3.0});
+  Vector<double> result(1);
+
+  result = lazy(v) * 2.0;
+
+  EXPECT_EQ(result.size(), 3);
+  EXPECT_DOUBLE_EQ(result(2), 6.0);
+  EXPECT_THROW(Matrix<double>{lazy(v) + 1.0}, MatrixError);
+}
+
+TEST(TensorExprTest, ChecksOperands) {
+  Tensor<int> a({2}, {1, 2});
+  Tensor<int> b({3}, {1, 2, 3});
+  Tensor<int> zeros({2}, {1, 0});
+
+  EXPECT_THROW(lazy(a) + b, TensorOpError);
+  EXPECT_THROW(lazy(a) / 0, TensorOpError);
+  EXPECT_THROW(lazy(a) / zeros, TensorOpError);
+  EXPECT_THROW(10 / lazy(zeros), TensorOpError);
+  EXPECT_THROW(a += lazy(b), TensorOpError);
+}
+
+TEST(TensorExprTest, StoredExpressionOwnsTemporaries) {
+  Matrix<double> a(2, 2, {1.0, 2.0, 3.0, 4.0});
+
+  auto expr = lazy(a.dot(a)) + 1.0;
+  Matrix<double> result = expr;
+
+  EXPECT_TRUE(result == Matrix<double>(2, 2, {8.0, 11.0, 16.0, 23.0}));
+}
+
+} // namespace txeo
@@ -251,6 +251,10 @@ TEST(TensorFuncTest, NormalizationAll) {
   txeo::TensorFunc<double>::normalize_by(tens5, txeo::NormalizationType::Z_SCORE);
   txeo::Tensor<double> resp5({1}, {3});
   EXPECT_TRUE(resp5 == tens5);
+  // Integral mean and deviation are computed in double precision and truncated once
+  txeo::Tensor<int> integers({2}, {0, 3});
+  txeo::TensorFunc<int>::normalize_by(integers, txeo::NormalizationType::Z_SCORE);
+  EXPECT_TRUE(integers == txeo::Tensor<int>({2}, {-1, 2}));
 }
 
 TEST(TensorFuncTest, NormalizationAxis) {
@@ -265,6 +269,10 @@ TEST(TensorFuncTest, NormalizationAxis) {
   EXPECT_NEAR(tens7_norm(0, 0), -1.2247448, 1e-5);
   EXPECT_NEAR(tens7_norm(1, 0), 0.00000, 1e-5);
   EXPECT_NEAR(tens7_norm(2, 0), 1.2247448, 1e-5);
+  txeo::Tensor<int> integers({2, 2}, {0, 1, 3, 1});
+  auto integers_norm =
+      txeo::TensorFunc<int>::normalize(integers, 0, txeo::NormalizationType::Z_SCORE);
+  EXPECT_TRUE(integers_norm == txeo::Tensor<int>({2, 2}, {-1, 0, 2, 0}));
 }
 
 TEST(TensorFuncTest, MakeNormalizeFunctionMinMaxGlobal) {
@@ -357,4 +365,14 @@ TEST(TensorFuncTest, MakeNormalizeFunctions3DTensor) {
   EXPECT_FLOAT_EQ(norm_fns[3](12), 1.0f);
 }
 
+TEST(TensorFuncTest, ComputeGramMatrix) {
+
+  Matrix<double> matrix(2, 3, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+
+  auto gram = TensorFunc<double>::compute_gram_matrix(matrix);
+
+  EXPECT_EQ(gram.shape(), TensorShape({3, 3}));
+  EXPECT_TRUE(gram == Matrix<double>(3, 3, {17.0, 22.0, 27.0, 22.0, 29.0, 36.0, 27.0, 36.0, 45.0}));
+}
+
 } // namespace txeo
\ No newline at end of file
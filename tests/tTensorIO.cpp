@@ -0,0 +1,112 @@
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+
+#include "txeo/Tensor.h"
+#include "txeo/TensorIO.h"
+#include "txeo/TensorShape.h"
+
+namespace txeo {
+namespace {
+
+namespace fs = std::filesystem;
+
+class TensorIOTest : public ::testing::Test {
+  protected:
+    void SetUp() override { fs::create_directory(test_dir); }
+
+    void TearDown() override { fs::remove_all(test_dir); }
+
+    const std::string test_dir = "test_data_binary";
+};
+
+TEST_F(TensorIOTest, BinaryRoundTrip) {
+  const std::string path = test_dir + "/tensor.txeo";
+  const Tensor<double> original({2, 3, 2}, {1., 2., 3., 4., 5., 6., 7., 8., 9., 10., 11., 12.});
+
+  TensorIO io{path};
+  io.write_binary_file(original);
+
+  auto loaded = io.read_binary_file<double>();
+  EXPECT_EQ(loaded.shape(), original.shape());
+  EXPECT_TRUE(loaded == original);
+  EXPECT_EQ(fs::file_size(path) % TensorIO::binary_alignment, 0);
+}
+
+TEST_F(TensorIOTest, BinaryMappedLoad) {
+  const std::string path = test_dir + "/mapped.txeo";
+  const Tensor<int> original({3, 2}, {1, 2, 3, 4, 5, 6});
+  TensorIO::write_binaryfile(original, path);
+
+  auto mapped = TensorIO::read_binaryfile<int>(path, true);
+  EXPECT_EQ(mapped.shape(), TensorShape({3, 2}));
+  EXPECT_TRUE(mapped == original);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(std::as_const(mapped).data()) %
+                TensorIO::binary_alignment,
+            0);
+
+  auto shared = mapped;
+  mapped(2, 1) = 60;
+  EXPECT_EQ(mapped(2, 1), 60);
+  EXPECT_EQ(shared(2, 1), 6);
+  EXPECT_EQ(TensorIO::read_binaryfile<int>(path)(2, 1), 6);
+}
+
+TEST_F(TensorIOTest, BinaryScalarAndEmpty) {
+  const std::string path = test_dir + "/scalar.txeo";
+  TensorIO io{path};
+
+  io.write_binary_file(Tensor<float>(TensorShape({}), 2.5f));
+  auto scalar = io.map_binary_file<float>();
+  EXPECT_EQ(scalar.order(), 0);
+  EXPECT_FLOAT_EQ(scalar(), 2.5f);
+
+  io.write_binary_file(Tensor<float>(TensorShape({0, 4})));
+  auto empty = io.map_binary_file<float>();
+  EXPECT_EQ(empty.shape(), TensorShape({0, 4}));
+}
+
+TEST_F(TensorIOTest, BinaryInvalidFiles) {
+  const std::string path = test_dir + "/invalid.txeo";
+  TensorIO io{path};
+
+  EXPECT_THROW(io.read_binary_file<int>(), TensorIOError);
+
+  io.write_binary_file(Tensor<int>({4}, {1, 2, 3, 4}));
+  EXPECT_THROW(io.read_binary_file<double>(), TensorIOError);
+  EXPECT_THROW(io.map_binary_file<float>(), TensorIOError);
+
+  fs::resize_file(path, fs::file_size(path) - 1);
+  EXPECT_THROW(io.read_binary_file<int>(), TensorIOError);
+  EXPECT_THROW(io.map_binary_file<int>(), TensorIOError);
+
+  std::ofstream{path} << "1,2,3\n4,5,6";
+  EXPECT_THROW(io.read_binary_file<int>(), TensorIOError);
+}
+
+TEST_F(TensorIOTest, BinaryMisalignedDataOffset) {
+  const std::string path = test_dir + "/tampered.txeo";
+  TensorIO io{path};
+  io.write_binary_file(Tensor<int>({4}, {1, 2, 3, 4}));
+  fs::resize_file(path, fs::file_size(path) + TensorIO::binary_alignment);
+
+  // Claims an alignment of 1 and moves the data section to an odd offset inside the file
+  const uint64_t alignment{1};
+  const uint64_t data_offset{TensorIO::binary_alignment + 1};
+  {
+    std::fstream wf{path, std::ios::in | std::ios::out | std::ios::binary};
+    wf.seekp(32); // alignment field, followed by data_offset
+    wf.write(reinterpret_cast<const char *>(&alignment), sizeof(alignment));
+    wf.write(reinterpret_cast<const char *>(&data_offset), sizeof(data_offset));
+  }
+
+  EXPECT_THROW(io.read_binary_file<int>(), TensorIOError);
+  EXPECT_THROW(io.map_binary_file<int>(), TensorIOError);
+}
+
+} // namespace
+} // namespace txeo
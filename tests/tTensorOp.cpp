@@ -248,6 +248,55 @@ TEST(TensorOpTest, HadamardDivBy) {
   ASSERT_FLOAT_EQ(left.data()[1], 5.0f);
 }
 
+TEST(TensorOpTest, HadamardDivByZeroLeavesOperandUnchanged) {
+  Tensor<float> left({3}, {15.0f, 25.0f, 35.0f});
+  Tensor<float> right({3}, {3.0f, 5.0f, 0.0f});
+  EXPECT_THROW(TensorOp<float>::hadamard_div_by(left, right), TensorOpError);
+  ASSERT_FLOAT_EQ(left.data()[0], 15.0f);
+  ASSERT_FLOAT_EQ(left.data()[1], 25.0f);
+}
+
+TEST(TensorOpTest, ElementwiseLongTensors) {
+  // Lengths that leave a remainder after the vectorized part of the loops
+  for (size_t size : {size_t{1}, size_t{17}, size_t{1029}}) {
+    Tensor<double> left({size}, 0.0);
+    Tensor<double> right({size}, 0.0);
+    for (size_t i{0}; i < size; ++i) {
+      left.data()[i] = static_cast<double>(i);
+      right.data()[i] = 2.0;
+    }
+
+    auto sum = TensorOp<double>::sum(left, right);
+    auto prod = TensorOp<double>::hadamard_prod(left, right);
+    auto diff = TensorOp<double>::subtract(1.0, left);
+    TensorOp<double>::divide_by(left, 4.0);
+    for (size_t i{0}; i < size; ++i) {
+      ASSERT_DOUBLE_EQ(sum.data()[i], i + 2.0);
+      ASSERT_DOUBLE_EQ(prod.data()[i], i * 2.0);
+      ASSERT_DOUBLE_EQ(diff.data()[i], 1.0 - i);
+      ASSERT_DOUBLE_EQ(left.data()[i], i / 4.0);
+    }
+  }
+}
+
+TEST(TensorOpTest, ElementwiseNarrowTypes) {
+  Tensor<short> s_left({3}, {100, -7, 30});
+  Tensor<short> s_right({3}, {20, 3, -5});
+  auto s_sum = TensorOp<short>::sum(s_left, s_right);
+  EXPECT_EQ(s_sum.data()[0], 120);
+  EXPECT_EQ(s_sum.data()[1], -4);
+  EXPECT_EQ(s_sum.data()[2], 25);
+  TensorOp<short>::divide_by(s_left, 2);
+  EXPECT_EQ(s_left.data()[0], 50);
+  EXPECT_EQ(s_left.data()[1], -3);
+
+  Tensor<bool> b_left({2}, {true, false});
+  Tensor<bool> b_right({2}, {true, true});
+  auto b_prod = TensorOp<bool>::hadamard_prod(b_left, b_right);
+  EXPECT_TRUE(b_prod.data()[0]);
+  EXPECT_FALSE(b_prod.data()[1]);
+}
+
 TEST(TensorOpTest, HandleEmptyTensor) {
   Tensor<int> empty_tensor({0}, {});
   EXPECT_THROW(TensorOp<int>::sum(empty_tensor, 5), TensorOpError);
@@ -321,6 +370,42 @@ TEST(TensorOpTest, MatrixProduct) {
   EXPECT_EQ(result(1, 1), 4 * 8 + 5 * 10 + 6 * 12);
 }
 
+TEST(TensorOpTest, MatrixProductAcrossBlocks) {
+
+  // Sizes that are not multiples of the kernel's row and panel blocking
+  size_t m{37}, k{150}, n{263};
+  std::vector<double> l_values(m * k), r_values(k * n);
+  for (size_t i{0}; i < l_values.size(); ++i)
+    l_values[i] = static_cast<double>(i % 7) - 3.0;
+  for (size_t i{0}; i < r_values.size(); ++i)
+    r_values[i] = static_cast<double>(i % 5) * 0.5;
+  txeo::Matrix<double> left(m, k, l_values);
+  txeo::Matrix<double> right(k, n, r_values);
+
+  auto result = TensorOp<double>::dot(left, right);
+
+  EXPECT_EQ(result.shape(), txeo::TensorShape({m, n}));
+  for (size_t i : {size_t{0}, size_t{4}, size_t{36}})
+    for (size_t j : {size_t{0}, size_t{255}, size_t{256}, size_t{262}}) {
+      double expected{0.0};
+      for (size_t p{0}; p < k; ++p)
+        expected += l_values[i * k + p] * r_values[p * n + j];
+      EXPECT_DOUBLE_EQ(result(i, j), expected);
+    }
+}
+
+TEST(TensorOpTest, MatrixProductShort) {
+
+  txeo::Matrix<short> left(2, 3, {1, 2, 3, 4, 5, 6});
+  txeo::Matrix<short> right(3, 1, {1, -1, 2});
+
+  auto result = TensorOp<short>::dot(left, right);
+
+  EXPECT_EQ(result.shape(), txeo::TensorShape({2, 1}));
+  EXPECT_EQ(result(0, 0), 5);
+  EXPECT_EQ(result(1, 0), 11);
+}
+
 TEST(TensorOpTest, MatrixProductIncompatibleDimensions) {
 
   txeo::Matrix<int> left(2, 3, {1, 2, 3, 4, 5, 6});
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "txeo/Loss.h"
+#include "txeo/Matrix.h"
+#include "txeo/Tensor.h"
+#include "txeo/TensorAgg.h"
+#include "txeo/TensorOp.h"
+#include "txeo/TensorPart.h"
+#include "txeo/TensorShape.h"
+#include "txeo/TensorView.h"
+#include "txeo/Vector.h"
+
+namespace txeo {
+
+TEST(TensorViewTest, WrapsTensorWithoutCopy) {
+  Matrix<int> m(2, 3, {1, 2, 3, 4, 5, 6});
+  TensorView<int> view{m};
+
+  EXPECT_EQ(view.data(), m.data());
+  EXPECT_EQ(view.shape(), TensorShape({2, 3}));
+  EXPECT_EQ(view.strides(), std::vector<size_t>({3, 1}));
+  EXPECT_EQ(view.dim(), 6);
+  EXPECT_TRUE(view.is_contiguous());
+  EXPECT_EQ(view(1, 2), 6);
+
+  Vector<double> v({1.0, 2.0, 3.0});
+  TensorView<double> vview{v};
+  EXPECT_EQ(vview.order(), 1);
+  EXPECT_DOUBLE_EQ(vview(2), 3.0);
+}
+
+TEST(TensorViewTest, SlicesRowsAndSteps) {
+  Matrix<int> m(4, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+  TensorView<int> view{m};
+
+  auto rows = view.rows(1, 3);
+  EXPECT_EQ(rows.data(), m.data() + 3);
+  EXPECT_TRUE(rows.is_contiguous());
+  EXPECT_TRUE(rows.to_matrix() == Matrix<int>(2, 3, {4, 5, 6, 7, 8, 9}));
+
+  auto even_rows = view.slice(0, 0, 4, 2);
+  EXPECT_FALSE(even_rows.is_contiguous());
+  EXPECT_TRUE(even_rows.to_matrix() == Matrix<int>(2, 3, {1, 2, 3, 7, 8, 9}));
+
+  auto odd_cols = view.slice(1, 1, 3, 2);
+  EXPECT_EQ(odd_cols.shape(), TensorShape({4, 1}));
+  EXPECT_TRUE(odd_cols.to_matrix() == Matrix<int>(4, 1, {2, 5, 8, 11}));
+
+  EXPECT_THROW(view.rows(2, 5), TensorViewError);
+  EXPECT_THROW(view.slice(2, 0, 1), TensorViewError);
+  EXPECT_THROW(view.slice(0, 0, 1, 0), TensorViewError);
+}
+
+TEST(TensorViewTest, SelectsColumns) {
+  Matrix<int> m(3, 4, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+  TensorView<int> view{m};
+
+  auto cols = view.rows(1, 3).cols({3, 0});
+  EXPECT_EQ(cols.shape(), TensorShape({2, 2}));
+  EXPECT_EQ(cols(1, 0), 12);
+  EXPECT_TRUE(cols.to_matrix() == Matrix<int>(2, 2, {8, 5, 12, 9}));
+
+  auto sliced = cols.slice(1, 1, 2);
+  EXPECT_TRUE(sliced.to_matrix() == Matrix<int>(2, 1, {5, 9}));
+
+  EXPECT_THROW(view.cols({4}), TensorViewError);
+  EXPECT_THROW(view.cols({}), TensorViewError);
+}
+
+TEST(TensorViewTest, VisitsHigherOrderViews) {
+  Tensor<int> t({2, 3, 2}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+  TensorView<int> view{t};
+
+  auto part = view.select(1, {2, 0}).slice(2, 1, 2);
+  std::vector<int> visited;
+  part.for_each([&visited](size_t i, const int &value) {
+    EXPECT_EQ(i, visited.size());
+    visited.push_back(value);
+  });
+  EXPECT_EQ(visited, std::vector<int>({5, 1, 11, 7}));
+  EXPECT_TRUE(part.to_tensor() == Tensor<int>({2, 2, 1}, {5, 1, 11, 7}));
+
+  std::vector<float> buffer{1.0f, 0.0f, 2.0f, 0.0f, 3.0f, 0.0f};
+  TensorView<float> strided{buffer.data(), TensorShape({3}), {2}};
+  EXPECT_TRUE(strided.to_tensor() == Tensor<float>({3}, {1.0f, 2.0f, 3.0f}));
+  EXPECT_THROW((TensorView<float>{buffer.data(), TensorShape({3}), {2, 1}}), TensorViewError);
+}
+
+TEST(TensorViewTest, OperatesOnViews) {
+  Matrix<double> m(4, 2, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0});
+  TensorView<double> view{m};
+
+  auto sum = TensorOp<double>::sum(view.rows(0, 2), view.rows(2, 4));
+  EXPECT_TRUE(sum == Tensor<double>({2, 2}, {6.0, 8.0, 10.0, 12.0}));
+
+  auto diff = TensorOp<double>::subtract(view.cols({1}), view.cols({0}));
+  EXPECT_TRUE(diff == Tensor<double>({4, 1}, {1.0, 1.0, 1.0, 1.0}));
+
+  auto prod = TensorOp<double>::hadamard_prod(view.slice(0, 0, 4, 2), view.slice(0, 1, 4, 2));
+  EXPECT_TRUE(prod == Tensor<double>({2, 2}, {3.0, 8.0, 35.0, 48.0}));
+
+  auto scaled = TensorOp<double>::multiply(view.cols({0}), 2.0);
+  EXPECT_TRUE(scaled == Tensor<double>({4, 1}, {2.0, 6.0, 10.0, 14.0}));
+
+  EXPECT_DOUBLE_EQ(TensorOp<double>::inner(view.cols({0}), view.cols({1})), 100.0);
+  EXPECT_THROW(TensorOp<double>::sum(view.rows(0, 1), view.rows(0, 2)), TensorOpError);
+}
+
+TEST(TensorViewTest, AggregatesViews) {
+  Matrix<int> m(3, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+  TensorView<int> view{m};
+
+  EXPECT_EQ(TensorAgg<int>::sum_all(view.cols({0, 2})), 30);
+  EXPECT_EQ(TensorAgg<int>::sum_all(m), 45);
+
+  auto by_col = TensorAgg<int>::reduce_sum(view.cols({0, 2}), {0});
+  EXPECT_TRUE(by_col == Tensor<int>({2}, {12, 18}));
+
+  auto by_row = TensorAgg<int>::reduce_mean(view.rows(1, 3), {1});
+  EXPECT_TRUE(by_row == Tensor<int>({2}, {5, 8}));
+
+  EXPECT_THROW(TensorAgg<int>::reduce_sum(view, {2}), TensorAggError);
+}
+
+TEST(TensorViewTest, ComputesLossOnViews) {
+  Matrix<double> data(3, 2, {1.0, 2.0, 3.0, 4.0, 5.0, 7.0});
+  TensorView<double> view{data};
+  Loss<double> loss{Matrix<double>(3, 1, {2.0, 4.0, 6.0})};
+
+  EXPECT_DOUBLE_EQ(loss.mse(view.cols({1})), 1.0 / 3.0);
+  EXPECT_DOUBLE_EQ(loss.mae(view.cols({0})), 1.0);
+  EXPECT_THROW(loss.mse(view.rows(0, 2).cols({1})), LossError);
+}
+
+TEST(TensorViewTest, SubMatrixFromRowRange) {
+  Matrix<int> m(3, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+  TensorView<int> rows = TensorView<int>{m}.rows(1, 3);
+
+  EXPECT_TRUE(TensorPart<int>::sub_matrix_cols(rows, {2}) == Matrix<int>(2, 1, {6, 9}));
+  EXPECT_TRUE(TensorPart<int>::sub_matrix_cols_exclude(rows, {1}) ==
+              Matrix<int>(2, 2, {4, 6, 7, 9}));
+  EXPECT_THROW(TensorPart<int>::sub_matrix_cols(rows, {3}), MatrixError);
+}
+
+} // namespace txeo